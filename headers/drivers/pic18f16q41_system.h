@@ -9,8 +9,105 @@
 #define OSC_TUNE 0x1F
 #define OSC_EN 0x60
 
+#define FOSC_HZ 64000000
+#define MIPS 16
+
+//SPI1BAUD value, SCK = FOSC / (2 * (SPI_BAUD + 1))
+#define SPI_BAUD 0
+
 #define MAX_FPS 60
 
+//Buttons on C3 through C7, active LO
+#define BUTTON_PINS 0xF8
+
+#define DEVICE_RAM_BYTES 1024
+
+//Hardware return stack depth of the PIC18
+#define HW_STACK_LEVELS 31
+
+//Byte painted over unused data stack
+#define STACK_PAINT 0xA5
+
+//Return stack probe, compiled out unless PW_STACK_PROBE is defined
+//Inline so it doesn't add a level of its own
+#ifdef PW_STACK_PROBE
+extern uint8_t stack_high_water;
+#define STACK_PROBE() do{ if(STKPTR > stack_high_water){ stack_high_water = STKPTR; } }while(0)
+#define STACK_HIGH_WATER stack_high_water
+#else
+#define STACK_PROBE()
+#define STACK_HIGH_WATER 0
+#endif
+
+//Frame time model, instruction cycles
+//SPI_TRANSFER_CYCLES is one byte on the wire, 8 SCK periods
+//SPI_CYCLES_PER_BYTE is one pass of the Spi1Send FIFO loop, TXWE check, write and index
+//SPI_CYCLES_PER_CALL is entry, DC select and return around each send
+//Calibrate the last two against SpiModelEnd's measured time on target
+//Only SPI is modelled, there is no per-function CPU cost table, so CPU-bound frames predict low
+#define SPI_TRANSFER_CYCLES ((8 * 2 * (SPI_BAUD + 1)) / 4)
+#define SPI_CYCLES_PER_BYTE 12
+#define SPI_CYCLES_PER_CALL 40
+
+//SPI byte counting, compiled out unless PW_FRAME_MODEL is defined
+//The counts read as 0 without it, SPI_MODEL_STATE_BYTES is the RAM they take
+#ifdef PW_FRAME_MODEL
+#define SPI_MODEL_COUNT(bytes) do{ spi_model_bytes += (bytes); spi_model_calls++; }while(0)
+#define SPI_MODEL_BYTES spi_model_bytes
+#define SPI_MODEL_CALLS spi_model_calls
+#define SPI_MODEL_STATE_BYTES 6
+#else
+#define SPI_MODEL_COUNT(bytes)
+#define SPI_MODEL_BYTES 0UL
+#define SPI_MODEL_CALLS 0U
+#define SPI_MODEL_STATE_BYTES 0
+#endif
+
+//Input latency, compiled in only with PW_LATENCY
+//A press edge stamps Timer3 from the IOC interrupt, the watched object's next draw arms,
+//the next SPI send completes the sample
+#define LATENCY_IDLE 0
+#define LATENCY_PRESSED 1
+#define LATENCY_ARMED 2
+
+//Timer3 on 500kHz MFINTOSC at 1:8, 16us per count
+#define LATENCY_US_PER_COUNT 16
+
+#ifdef PW_LATENCY
+#define LATENCY_IOC_PINS BUTTON_PINS
+#define LATENCY_EDGES(keep) LatencyEdges(keep)
+#define LATENCY_DRAW(object) do{ if(latency_state == LATENCY_PRESSED && (latency_watch == NULL || latency_watch == (object))){ latency_state = LATENCY_ARMED; } }while(0)
+#define LATENCY_SEND() do{ if(latency_state == LATENCY_ARMED){ LatencySample(); } }while(0)
+#else
+#define LATENCY_IOC_PINS 0
+#define LATENCY_EDGES(keep)
+#define LATENCY_DRAW(object)
+#define LATENCY_SEND()
+#endif
+
+//UART1 telemetry out on RA4, compiled in only with PW_TELEMETRY
+//BRGS high, baud = FOSC / (4 * (UART_BRG + 1)), 138 gives 115200
+#define UART_BRG 138
+#define UART_TX_PPS 0x10
+
+//Ring buffer size, power of 2
+#define UART_RING 64
+
+//Static RAM the ring and its indices take
+#ifdef PW_TELEMETRY
+#define UART_DRAIN() Uart1Drain()
+#define UART_BYTES (UART_RING + 2)
+#else
+#define UART_DRAIN()
+#define UART_BYTES 0
+#endif
+
+#define MAX_TIMEOUT_MS 1000
+
+//Time SPI1 is given to settle after Spi1TxInit before the first byte is sent
+//Covered by the ST7789 reset hold rather than blocking in Spi1TxInit
+#define SPI_SETTLE_MS 15
+
 #define SYSTEM_OK 0
 #define SYSTEM_INVALID_INPUT 1
 #define SYSTEM_DOWNSTREAM_ERROR 32
@@ -19,6 +116,26 @@
 
 typedef uint8_t SystemStatus;
 
+//Input latency totals, see LatencyReport
+typedef struct{
+	uint16_t count;
+	uint32_t min_us;
+	uint32_t mean_us;
+	uint32_t max_us;
+	uint8_t min_frames;
+	uint8_t mean_frames;
+	uint8_t max_frames;
+} LatencyStats;
+
+#ifdef PW_FRAME_MODEL
+extern uint32_t spi_model_bytes;
+extern uint16_t spi_model_calls;
+#endif
+#ifdef PW_LATENCY
+extern volatile uint8_t latency_state;
+extern const void* latency_watch;
+#endif
+
 SystemStatus PinInit(void);
 SystemStatus ClockInit(void);
 SystemStatus TickClockInit(uint8_t fps);
@@ -29,8 +146,32 @@ SystemStatus PWMSetPeriod(uint16_t period);
 SystemStatus PWMSetPrescaler(uint8_t scale);
 SystemStatus StartTick(void);
 SystemStatus CheckTick(uint8_t* tick);
+SystemStatus WaitTick(uint8_t buttons, uint8_t* tick);
+SystemStatus TickRemaining(uint8_t* remaining);
+SystemStatus IdleReport(uint16_t* idle, uint16_t* active);
 SystemStatus DelayMs(uint16_t ms);
+SystemStatus DelayMsIdle(uint16_t ms);
+SystemStatus StartTimeout(uint16_t ms);
+SystemStatus CheckTimeout(uint8_t* timeout);
 SystemStatus Spi1TxInit(void);
 SystemStatus Spi1Send(uint8_t* data, uint8_t length);
+SystemStatus Spi1SendRepeat(uint8_t hi, uint8_t lo, uint16_t count);
+SystemStatus SpiModelStart(void);
+SystemStatus SpiModelEnd(uint16_t* predicted_us, uint16_t* measured_us);
+SystemStatus SpiModelElapsed(uint16_t* measured_us);
+#ifdef PW_TELEMETRY
+SystemStatus Uart1TxInit(void);
+SystemStatus Uart1Queue(uint8_t* data, uint8_t length);
+SystemStatus Uart1Drain(void);
+#endif
+#ifdef PW_LATENCY
+SystemStatus LatencyInit(const void* watch);
+SystemStatus LatencyEdges(uint8_t keep);
+SystemStatus LatencySample(void);
+SystemStatus LatencyReport(LatencyStats* stats);
+#endif
+SystemStatus StackReport(uint8_t* high_water, uint8_t* overflowed);
+SystemStatus StackPaint(uint8_t* start, uint16_t length);
+SystemStatus StackUnused(uint8_t* start, uint16_t length, uint16_t* unused);
 
 #endif
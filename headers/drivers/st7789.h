@@ -4,6 +4,16 @@
 #include <stdint.h>
 #include "pic18f16q41_system.h"
 
+#define ST7789_INIT_IDLE 0
+#define ST7789_INIT_RESET 1
+#define ST7789_INIT_RELEASE 2
+#define ST7789_INIT_SOFT_RESET 3
+#define ST7789_INIT_SLEEP_OUT 4
+#define ST7789_INIT_READY 5
+
+#define SCREEN_LAST 239
+#define FRAME_LINES 320
+
 extern const uint8_t soft_reset;
 extern const uint8_t sleep_out;
 extern const uint8_t access_control;
@@ -13,6 +23,8 @@ extern const uint8_t display_on;
 extern const uint8_t col_address;
 extern const uint8_t row_address;
 extern const uint8_t memory_write;
+extern const uint8_t scroll_define;
+extern const uint8_t scroll_start;
 
 extern const uint8_t access;
 extern const uint8_t format;
@@ -20,10 +32,17 @@ extern const uint8_t format;
 extern const uint8_t span[4];
 
 SystemStatus St7789Init(void);
+SystemStatus St7789InitStart(void);
+SystemStatus St7789InitStep(uint8_t* ready);
 SystemStatus St7789Cmd(const uint8_t* cmd);
 SystemStatus St7789Data(uint8_t* data, uint16_t length);
+SystemStatus St7789Color(uint8_t color_hi, uint8_t color_lo, uint16_t pixels);
 SystemStatus St7789Flash(uint8_t color_hi, uint8_t color_lo);
 SystemStatus St7789Clear(void);
+SystemStatus St7789Window(uint8_t start_row, uint8_t end_row, uint8_t start_col, uint8_t end_col);
 SystemStatus St7789Draw(uint8_t start_row, uint8_t end_row, uint8_t start_col, uint8_t end_col, uint8_t* art, uint8_t length);
+SystemStatus St7789Fill(uint8_t start_row, uint8_t end_row, uint8_t start_col, uint8_t end_col, uint8_t color_hi, uint8_t color_lo);
+SystemStatus St7789ScrollArea(uint16_t top_fixed, uint16_t scroll_lines, uint16_t bottom_fixed);
+SystemStatus St7789ScrollStart(uint16_t line);
 
 #endif
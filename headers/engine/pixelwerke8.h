@@ -4,9 +4,71 @@
 #include <stdint.h>
 #include "pixelwerke8_assets.h"
 #include "pixelwerke8_mono.h"
+#include "pixelwerke8_particles.h"
 #include "audio.h"
 
-#define MAX_SPRITES_ENGINE 256
+//Telemetry record, sent over UART1 when built with PW_TELEMETRY
+//[0] sync, [2..1] frame, [8..3] phase times in us, [12..9] SPI bytes, [14..13] SPI sends
+//[15] Sprites alive, [16] collisions found, [17] sum of [16..1]
+//Multi-byte fields are LO first, SPI counts need PW_FRAME_MODEL
+#define TELEMETRY_SYNC 0xA5
+#define TELEMETRY_PHASES 3
+#define TELEMETRY_BYTES 18
+
+//Static RAM the frame being built takes, frame number, phase times and collisions
+#ifdef PW_TELEMETRY
+#define TELEMETRY_STATE_BYTES (2 + TELEMETRY_PHASES * 2 + 1)
+#else
+#define TELEMETRY_STATE_BYTES 0
+#endif
+
+//RAM kept back from Sprites for XC8's compiled stack
+//With art expanded on transmit, the deepest engine chain, DrawSprite to ExpandBits to St7789Color, needs only a few dozen bytes
+//The rest is headroom for the game's own locals and interrupt frames, StackUnused shows what is left
+#define PW_STACK_RESERVE 256
+
+//RAM kept back for the engine instance, note bank, and driver and renderer state
+#define PW_STATIC_RESERVE 128
+
+//RAM taken by instrumentation, each part is 0 unless its flag is defined
+#define PW_DEBUG_RESERVE (SPI_MODEL_STATE_BYTES + OVERDRAW_BYTES + UART_BYTES + TELEMETRY_STATE_BYTES)
+
+//Largest Sprite count the device can hold with these reserves
+#define PW_SPRITES_FIT ((DEVICE_RAM_BYTES - PW_STACK_RESERVE - PW_STATIC_RESERVE - PW_DEBUG_RESERVE) / SPRITE_BYTES)
+
+//Sprite capacity, override with -DPW_MAX_SPRITES=n
+//Defaults to 64, or as many as fit when instrumentation takes its share
+//Must fit a uint8_t and the RAM budget above, the build fails if it doesn't
+#ifndef PW_MAX_SPRITES
+#if PW_SPRITES_FIT < 64
+#define PW_MAX_SPRITES PW_SPRITES_FIT
+#else
+#define PW_MAX_SPRITES 64
+#endif
+#endif
+
+#if PW_MAX_SPRITES > 255
+#error "PW_MAX_SPRITES must fit in a uint8_t"
+#endif
+
+#define MAX_SPRITES_ENGINE PW_MAX_SPRITES
+
+#if PW_MAX_SPRITES > PW_SPRITES_FIT
+#error "PW_MAX_SPRITES does not fit in device RAM, see PW_SPRITES_FIT"
+#endif
+
+#define VIEW_TILES_X (TILE_PIXEL_CONV_X + 1)
+#define VIEW_TILES_Y (TILE_PIXEL_CONV_Y + 1)
+
+#define ENGINE_FLAG_CAMERA 0x01
+#define ENGINE_FLAG_OVERLAY 0x02
+
+#define HUD_MAX_DIGITS 5
+#define HUD_BLANK 0xFF
+
+//Solidity bitmap row, 60 tiles padded to 64 bits
+#define SOLID_ROW_BYTES 8
+#define SOLID_MAP_BYTES (SOLID_ROW_BYTES * VIEW_TILES_X)
 
 #define ENGINE_OK 0
 #define ENGINE_INVALID_INPUT 1
@@ -24,18 +86,95 @@ typedef uint8_t EngineStatus;
 //[0] is collision detected with player
 typedef uint8_t GameFlags;
 
-//Engine instance to set up for the game
+//Engine context, all state for one running game
+//Games may declare their own, set them up with PWContextInit and switch with PWEngineSelect
+//Only the selected context runs, renderer scroll and clip, particles and audio are global
+//So contexts switch games or scenes, two engines can't render side by side
 typedef struct EngineInstance EngineInstance;
 
+struct EngineInstance{
+	//Max sprites to be allowed in this game instance
+	//Max max is PW_MAX_SPRITES, set at compile time above
+	uint8_t max_sprites;
+	
+	//Sprites in use, the last count given to PWMoveSprites, PWRedrawSprites or PWRepackSprites
+	//Starts at max_sprites, bounds the engine's own walks over the array
+	uint8_t active_sprites;
+	
+	//[7..2] are undefined
+	//[1] is overlay up, set by PWDisplayOverlay
+	//[0] is camera active, set by PWSetWorld
+	uint8_t engine_flags;
+	
+	//Array of all sprites in the game
+	Sprite* sprites;
+	
+	//World map in flash, NULL if the game has no world
+	const WorldMap* world;
+	
+	//World tile shown at the top-left of the screen
+	uint16_t camera_x;
+	uint16_t camera_y;
+	
+	//Collision masks indexed by Sprite animation, NULL if unused
+	const CollisionMask** masks;
+	uint8_t mask_count;
+	
+	//Solidity bitmap over the tile grid, NULL if unused
+	const uint8_t* solid;
+	
+	//Overlay message box, first x, last x, first y, last y in logical pixels
+	uint8_t overlay[4];
+	
+	//Where PWRedrawSpritesBudget's guaranteed redraw looks first
+	uint8_t redraw_cursor;
+};
+
+//Numeric HUD counter that remembers what it last showed
+typedef struct{
+	//Top-left logical pixel address of the first digit
+	uint16_t address;
+	
+	//Number of digits shown, 1 to HUD_MAX_DIGITS, zero-padded
+	uint8_t digits;
+	
+	//Digits on screen now, most significant first, HUD_BLANK if never drawn
+	uint8_t shown[HUD_MAX_DIGITS];
+} HudCounter;
+
 EngineStatus PWEngineInit(uint8_t sprites_needed, uint8_t flags, Sprite* sprite_array, uint8_t* notes, uint8_t* colors);
+EngineStatus PWContextInit(EngineInstance* context, uint8_t sprites_needed, uint8_t flags, Sprite* sprite_array);
+EngineStatus PWEngineReady(uint8_t* ready);
+EngineStatus PWSetCollisionMasks(const CollisionMask** masks, uint8_t count);
 EngineStatus PWDetectCollisions(uint8_t start, uint16_t* colliders);
+EngineStatus PWDetectCollisionsBetween(uint8_t start, uint8_t first_category, uint8_t second_category, uint16_t* colliders);
 EngineStatus PWRepackSprites(uint8_t old_count, uint8_t* new_count);
+EngineStatus PWSetSolidity(const uint8_t* solid);
+EngineStatus PWCheckSolid(Sprite* sprite, uint8_t* blocked);
+EngineStatus PWCheckMove(Sprite* sprite, uint8_t* blocked);
 EngineStatus PWMoveSprites(uint8_t sprite_count);
 EngineStatus PWRedrawSprites(uint8_t sprite_count);
+EngineStatus PWRedrawSpritesBudget(uint8_t sprite_count, uint8_t reserve, uint8_t* deferred);
+EngineStatus PWSetPriority(Sprite* sprite, uint8_t priority);
+EngineStatus PWSetFlip(Sprite* sprite, uint8_t flip);
+EngineStatus PWFaceVelocity(Sprite* sprite);
+EngineStatus PWRequestRedraw(Sprite* sprite);
 EngineStatus PWEraseSprite(Sprite* sprite);
 EngineStatus PWPlayTone(uint8_t tone);
 EngineStatus PWSilence(void);
+EngineStatus PWHudInit(HudCounter* hud, uint16_t address, uint8_t digits);
+EngineStatus PWHudSet(HudCounter* hud, uint16_t value);
 EngineStatus PWDisplayMessage(uint8_t** message, uint8_t* str_lens, uint8_t length);
+EngineStatus PWDisplayOverlay(uint8_t** message, uint8_t* str_lens, uint8_t length);
+EngineStatus PWDismissOverlay(void);
+EngineStatus PWSetWorld(const WorldMap* world, uint16_t x, uint16_t y);
+EngineStatus PWCameraMove(uint16_t x, uint16_t y);
+EngineStatus PWCameraPlace(Sprite* sprite, uint16_t world_x, uint16_t world_y);
 EngineInstance* PWEngineGetInstance(void);
+EngineStatus PWEngineSelect(EngineInstance* context);
+#ifdef PW_TELEMETRY
+EngineStatus PWTelemetryPhase(uint8_t phase);
+EngineStatus PWTelemetrySend(void);
+#endif
 
 #endif
@@ -8,18 +8,37 @@
 #define ASSET_FAILED_OP 64
 #define ASSET_UNKNOWN_ERROR 128
 
+#define MASK_MAX_ROWS 10
+
+#define CATEGORY_DEFAULT 0x01
+#define CATEGORY_ALL 0x0F
+
+//Packed Sprite record size, checked against sizeof(Sprite) by the engine
+#define SPRITE_BYTES 7
+
+#define SPRITE_REDRAW 0x80
+#define SPRITE_PRIORITY 0x60
+#define SPRITE_PRIORITY_SHIFT 5
+#define PRIORITY_LEVELS 4
+#define SPRITE_FLIP_X 0x80
+#define SPRITE_FLIP_Y 0x40
+#define ANIMATION_MASK 0x3F
+#define PHASE_MASK 0x1F
+#define PHASE_FULL 32
+
 typedef uint8_t AssetStatus;
 
 //Sets SpriteAddress to 16 bits
 typedef uint16_t AssetAddress;
 
+//Sprite record, every field is packed so RAM per Sprite stays at SPRITE_BYTES
 typedef struct{
 	//An address
 	//[31..16] are x
 	//[15..0] are y
 	AssetAddress address;
 	
-	//[7..3] are speed
+	//[7..3] are speed, in 32nds of a tile per move call, 0 is a full tile
 	//[2..0] are direction
 	uint8_t velocity;
 	
@@ -31,10 +50,39 @@ typedef struct{
 	//[0] is collisian enabled 1 vs disabled 0
 	uint8_t sprite_flags;
 	
-	//Index of this sprite's animation
+	//[7] is mirrored along x, [6] is mirrored along y, drawn from the same art
+	//[5..0] are the index of this sprite's animation
 	uint8_t animation;
+	
+	//[7..4] are the collision layers this sprite belongs to, one bit per layer
+	//[3..0] are the collision layers this sprite collides with
+	//A pair is only tested if each one's category is in the other's collides with
+	uint8_t layers;
+	
+	//[7] is redraw pending 1 vs up to date 0
+	//[6..5] are redraw priority, 0 is drawn first, see PWRedrawSpritesBudget
+	//[4..0] are the movement phase, speed is added each move call
+	uint8_t phase;
 } Sprite;
 
+//A world map larger than the screen, kept in flash
+typedef struct{
+	//Packed 4-bit tile art, two tiles per byte, HI first, same as Sprite art
+	//Stored column by column, each column padded to a whole byte
+	const uint8_t* cells;
+	
+	//Size in tiles, at least the size of the screen
+	uint16_t width;
+	uint16_t height;
+} WorldMap;
+
+//A pixel collision mask built from Sprite art
+typedef struct{
+	//One row per logical pixel along x, up to 5 tiles of 2
+	//[15..0] are logical pixels along y, MSB first
+	uint16_t rows[MASK_MAX_ROWS];
+} CollisionMask;
+
 //Some unused structs to keep in mind for later assets
 //Subject to change as-needed
 typedef struct{
@@ -54,5 +102,6 @@ typedef struct{
 //End unused assets
 
 AssetStatus SpriteInit(Sprite* sprite, AssetAddress start_address, uint8_t type);
+AssetStatus MaskInit(CollisionMask* mask, uint8_t type, uint8_t sprite_flags);
 
 #endif
@@ -12,15 +12,26 @@
 #define MAX_PIXELS 64
 
 #define TILE_SIZE 2
+#define TILE_PIXELS (TILE_SIZE * PIXEL_SIZE)
 
 #define SCREEN_RES_X 240
 #define SCREEN_RES_Y 240
 
+#define LOGICAL_LAST ((SCREEN_RES_X / PIXEL_SIZE) - 1)
+
 #define TILE_PIXEL_CONV_X (((SCREEN_RES_X / PIXEL_SIZE) / TILE_SIZE) - 1)
 #define TILE_PIXEL_CONV_Y (((SCREEN_RES_Y / PIXEL_SIZE) / TILE_SIZE) - 1)
 
 #define CHAR_ARRAY_SIZE 5 * 5 * PIXEL_SQUARE * 2
 
+//Run-length image format, 1-bit art
+//Two header bytes: height along x, then width along y, in logical pixels
+//Then runs in window order, y fastest, runs may cross rows
+//Each run byte is [7] color bit, [6..0] run length - 1
+#define IMAGE_HEADER 2
+#define RLE_COLOR 0x80
+#define RLE_LENGTH 0x7F
+
 #define MAX_LINES (SCREEN_RES_X / (6 * PIXEL_SIZE))
 #define MAX_LINE_LENGTH (SCREEN_RES_X / (5 * PIXEL_SIZE))
 
@@ -39,15 +50,65 @@ extern uint8_t off_color_hi;
 
 typedef uint8_t RenderStatus;
 
+//Overdraw counting, compiled in only with PW_OVERDRAW
+//Counts pixel writes per screen cell and per call site, and OFF writes onto cells already OFF
+//Redundancy is tracked per whole cell, an OFF fill counts only over a cell already cleared in full
+//Pixel-level waste, like a ClearSprite whose pixels are redrawn straight after, isn't caught
+#ifdef PW_OVERDRAW
+#define OVERDRAW_CELL 30
+#define OVERDRAW_GRID (SCREEN_RES_X / OVERDRAW_CELL)
+
+//Call sites, where each write came from
+#define OVERDRAW_FILL 0
+#define OVERDRAW_CLEAR_SPRITE 1
+#define OVERDRAW_ERASE_CHAR 2
+#define OVERDRAW_CLEAR_SCREEN 3
+#define OVERDRAW_ART 4
+#define OVERDRAW_COLUMN 5
+#define OVERDRAW_IMAGE 6
+#define OVERDRAW_SITES 7
+
+//Totals for one call site, in true pixels
+typedef struct{
+	uint32_t writes;
+	uint32_t redundant;
+} OverdrawSite;
+
+//Static RAM the counts take, heat, blank bits, sites and the current site
+#define OVERDRAW_BYTES (OVERDRAW_GRID * OVERDRAW_GRID * 2 + OVERDRAW_GRID + OVERDRAW_SITES * 8 + 1)
+#else
+#define OVERDRAW_BYTES 0
+#endif
+
 RenderStatus PW8MonoInit(uint8_t* game_colors);
+RenderStatus PW8MonoInitStep(uint8_t* ready);
 RenderStatus PW8MonoDrawPixel(uint16_t address);
+RenderStatus PW8MonoFillRect(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit);
+RenderStatus PW8MonoDrawRect(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit);
+RenderStatus PW8MonoDrawLine(uint16_t start, uint16_t end, uint8_t bit);
+RenderStatus PW8MonoDrawVSpan(uint8_t x, uint8_t y_start, uint8_t y_end, uint8_t bit);
+RenderStatus PW8MonoDrawHSpan(uint8_t y, uint8_t x_start, uint8_t x_end, uint8_t bit);
+RenderStatus PW8MonoDrawPixels(uint16_t* addresses, uint8_t* bits, uint8_t count);
 RenderStatus PW8MonoDrawTile(Tile* tile, uint8_t* art);
+RenderStatus PW8MonoSetClip(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end);
 RenderStatus PW8MonoDrawSprite(Sprite* sprite);
 RenderStatus PW8MonoClearSprite(Sprite* sprite);
 RenderStatus PW8MonoWriteChar(uint8_t character, uint16_t address);
 RenderStatus PW8MonoWriteString(uint8_t* string, uint8_t length, uint16_t address);
 RenderStatus PW8MonoEraseChar(uint16_t address);
+RenderStatus PW8MonoBlitChar(uint8_t character, uint16_t address);
 RenderStatus PW8MonoEraseString(uint16_t address, uint8_t length);
 RenderStatus PW8MonoClearScreen(void);
+RenderStatus PW8MonoSetScrollRegion(uint8_t first_tile, uint8_t tile_count);
+RenderStatus PW8MonoScrollOffset(int8_t tiles, uint8_t* exposed);
+RenderStatus PW8MonoScroll(int8_t tiles, uint8_t* exposed);
+RenderStatus PW8MonoDrawColumn(uint8_t tile_x, const uint8_t* cells, uint8_t odd);
+RenderStatus PW8MonoDrawImage(const uint8_t* image, uint16_t address);
+
+#ifdef PW_OVERDRAW
+RenderStatus PW8MonoOverdrawReset(void);
+RenderStatus PW8MonoOverdrawSites(const OverdrawSite** sites);
+RenderStatus PW8MonoOverdrawShow(void);
+#endif
 
 #endif
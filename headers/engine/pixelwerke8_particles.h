@@ -0,0 +1,37 @@
+#ifndef PIXELWERKE8_PARTICLES_H
+#define PIXELWERKE8_PARTICLES_H
+
+#include <stdint.h>
+#include "pixelwerke8_mono.h"
+
+#define PARTICLE_OK 0
+#define PARTICLE_INVALID_INPUT 1
+#define PARTICLE_POOL_FULL 2
+#define PARTICLE_DOWNSTREAM_ERROR 32
+#define PARTICLE_FAILED_OP 64
+#define PARTICLE_UNKNOWN_ERROR 128
+
+//Sort key for free particles, sinks them past every live one
+#define PARTICLE_FREE_KEY 0xFFFF
+
+typedef uint8_t ParticleStatus;
+
+typedef struct{
+	//Logical pixel address
+	uint8_t x;
+	uint8_t y;
+	
+	//[7..4] are signed x step per update
+	//[3..0] are signed y step per update
+	uint8_t velocity;
+	
+	//Updates left to live, 0 is free
+	uint8_t life;
+} Particle;
+
+ParticleStatus PWParticlesInit(Particle* pool, uint8_t count);
+ParticleStatus PWParticleSpawn(uint8_t x, uint8_t y, uint8_t velocity, uint8_t life);
+ParticleStatus PWParticlesUpdate(void);
+ParticleStatus PWParticlesClear(void);
+
+#endif
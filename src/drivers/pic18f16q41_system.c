@@ -1,5 +1,51 @@
 #include "pic18f16q41_system.h"
 
+#ifdef PW_STACK_PROBE
+//Deepest hardware return stack level seen by STACK_PROBE
+uint8_t stack_high_water = 0;
+#endif
+
+//Bytes and sends counted by SPI_MODEL_COUNT since SpiModelStart
+#ifdef PW_FRAME_MODEL
+uint32_t spi_model_bytes = 0;
+uint16_t spi_model_calls = 0;
+
+//SPI_MODEL_STATE_BYTES must match, it's counted in the RAM budget in pixelwerke8.h
+typedef char pw_spi_model_budget[(sizeof(spi_model_bytes) + sizeof(spi_model_calls) == SPI_MODEL_STATE_BYTES) ? 1 : -1];
+#endif
+
+//Input latency state, see LatencyInit
+#ifdef PW_LATENCY
+volatile uint8_t latency_state = LATENCY_IDLE;
+const void* latency_watch = NULL;
+static volatile uint16_t latency_stamp = 0;
+static volatile uint8_t latency_frame_stamp = 0;
+static uint8_t latency_frames = 0;
+
+//Input latency totals in Timer3 counts and frames
+static uint16_t latency_count = 0;
+static uint16_t latency_min = 0xFFFF;
+static uint16_t latency_max = 0;
+static uint32_t latency_sum = 0;
+static uint8_t latency_min_frames = 0xFF;
+static uint8_t latency_max_frames = 0;
+static uint16_t latency_sum_frames = 0;
+#endif
+
+//UART1 ring buffer, head is the next free byte, tail the next to send
+#ifdef PW_TELEMETRY
+static uint8_t uart_ring[UART_RING];
+static volatile uint8_t uart_head = 0;
+static volatile uint8_t uart_tail = 0;
+
+//UART_BYTES must match, it's counted in the RAM budget in pixelwerke8.h
+typedef char pw_uart_budget[(sizeof(uart_ring) + sizeof(uart_head) + sizeof(uart_tail) == UART_BYTES) ? 1 : -1];
+#endif
+
+//Timer2 counts spent idle and active in WaitTick since the last IdleReport
+static uint16_t idle_ticks = 0;
+static uint16_t active_ticks = 0;
+
 //Function to initialize pins for input/output
 //Takes no inputs
 //Initializes pins for their intended tasks
@@ -160,6 +206,9 @@ SystemStatus PWMDisable(void){
 //Returns status
 SystemStatus PWMSetDutyCycle(uint16_t cycle){
 	
+	//Leaf of the audio chain
+	STACK_PROBE();
+	
 	//Set HI byte to MSB of input
 	PWM1S1P1H = (cycle >> 8) & 0x00FF;
 	
@@ -228,6 +277,11 @@ SystemStatus StartTick(void){
 	//Enable timer
 	T2CONbits.ON = 1;
 	
+	//Each StartTick begins a frame
+#ifdef PW_LATENCY
+	latency_frames++;
+#endif
+	
 	//Return OK
 	return SYSTEM_OK;
 }
@@ -255,14 +309,132 @@ SystemStatus CheckTick(uint8_t* tick){
 	return SYSTEM_OK;
 }
 
+//Function to get the time left in this frame
+//Takes in a pointer to the remaining Timer2 counts, about 1ms each
+//0 once the tick has come, the frame is over budget
+//Returns status
+SystemStatus TickRemaining(uint8_t* remaining){
+	
+	//Validate input
+	if(remaining == NULL){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	//Count, then check ON, so a tick between the two reads as 0
+	uint8_t count = T2TMR;
+	
+	*remaining = T2CONbits.ON ? T2PR - count : 0;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to wait for the next tick without burning power
+//Takes in the buttons, as in BUTTON_PINS, whose press may end the wait early, 0 for none
+//Takes in a pointer to the tick "boolean", 1 if the tick came, 0 if a button did
+//Enables the Timer2 and IOC interrupts and idles the CPU until one fires
+//An enabled interrupt wakes the core even with GIE off, so no ISR is needed
+//IDLE keeps FOSC peripherals like the PWM and SPI running
+//Adds the frame's active and idle split to IdleReport
+//IDLEN is put back as found, so a later SLEEP() of the game's still means full Sleep
+//Returns status
+SystemStatus WaitTick(uint8_t buttons, uint8_t* tick){
+	
+	//Validate input
+	if(tick == NULL || (buttons & ~BUTTON_PINS)){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	//Clear flag before checking, so a tick between the two still wakes
+	PIR3bits.TMR2IF = 0;
+	
+	//Time into the frame so far was active
+	uint8_t elapsed = T2TMR;
+	
+	//Tick already came, nothing to wait for
+	if(T2CONbits.ON == 0){
+		active_ticks += T2PR;
+		*tick = 1;
+		return SYSTEM_OK;
+	}
+	
+	//Arm wake sources, presses pull the pins LO
+	//With PW_LATENCY every button stays armed, so a press mid-wait is stamped on waking
+	IOCCN = buttons | LATENCY_IOC_PINS;
+	IOCCF = 0;
+	PIE0bits.IOCIE = ((buttons | LATENCY_IOC_PINS) != 0);
+	PIE3bits.TMR2IE = 1;
+	
+	//SLEEP enters IDLE, keep the caller's setting to put back
+	uint8_t idlen = CPUDOZEbits.IDLEN;
+	CPUDOZEbits.IDLEN = 1;
+	
+	//Hold off the ISR, wakes resume here instead, and the UART is fed in the loop
+	uint8_t gie = INTCON0bits.GIE;
+	INTCON0bits.GIE = 0;
+	
+	//Loop, another enabled interrupt may wake early
+	while(T2CONbits.ON && !(IOCCF & buttons)){
+		SLEEP();
+		NOP();
+		LATENCY_EDGES(buttons);
+		UART_DRAIN();
+	}
+	
+	//Stamp any press that came after the last wake
+	LATENCY_EDGES(0);
+	
+	//Disarm wake sources and restore IDLEN before restoring GIE, Timer2 has no ISR
+	//IOC has one only with PW_LATENCY, which keeps the buttons armed for it
+	PIE3bits.TMR2IE = 0;
+	PIE0bits.IOCIE = (LATENCY_IOC_PINS != 0);
+	IOCCN = LATENCY_IOC_PINS;
+	IOCCF = 0;
+	PIR3bits.TMR2IF = 0;
+	CPUDOZEbits.IDLEN = idlen;
+	
+	INTCON0bits.GIE = gie;
+	
+	*tick = (T2CONbits.ON == 0);
+	
+	//Split the frame, a button wake counts only up to now
+	active_ticks += elapsed;
+	idle_ticks += (*tick ? T2PR : T2TMR) - elapsed;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to report time spent idle
+//Takes pointers to the idle and active times in Timer2 counts, about 1ms each
+//Covers frames waited on with WaitTick since the last report, then resets
+//Returns status
+SystemStatus IdleReport(uint16_t* idle, uint16_t* active){
+	
+	//Validate input
+	if(idle == NULL || active == NULL){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	*idle = idle_ticks;
+	*active = active_ticks;
+	
+	idle_ticks = 0;
+	active_ticks = 0;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
 //Function to block CPU for x ms
 //Takes in number of ms to delay
 //Blocks CPU with NOP for x ms
 //Returns OK
 //Should be quite accurate after ClockInit
 SystemStatus DelayMs(uint16_t ms){
-	//Enable Timer 0
-    T0CON0 |= 0x80;
+	//Enable Timer 0, 8-bit, 1:1 postscaler
+	//Written outright, StartTimeout leaves Timer0 in 16-bit mode
+    T0CON0 = 0x80;
     
     //Set 1:16 prescaler, FOSC/4
     //Gives 1us per tick
@@ -302,6 +474,133 @@ SystemStatus DelayMs(uint16_t ms){
 	return SYSTEM_OK;
 }
 
+//Function to idle the CPU for x ms
+//Takes in number of ms to delay
+//Same Timer0 timing as DelayMs, but sleeps in IDLE between period matches
+//The Timer0 interrupt wakes the core even with GIE off, so no ISR is needed
+//IDLEN is put back as found, like WaitTick
+//Returns OK
+SystemStatus DelayMsIdle(uint16_t ms){
+	
+	//Set 1:16 prescaler, FOSC/4
+	//Gives 1us per tick
+	T0CON1 = 0x44;
+	
+	//Set timer period to 249, ie 250 ticks per period
+	//Gives 250us per period
+	TMR0H = 0xF9;
+	
+	//Reset timer to 0
+	TMR0L = 0;
+	
+	//Arm the period match wake
+	PIR3bits.TMR0IF = 0;
+	PIE3bits.TMR0IE = 1;
+	
+	//SLEEP enters IDLE so Timer0 keeps its FOSC clock, keep the caller's setting to put back
+	uint8_t idlen = CPUDOZEbits.IDLEN;
+	CPUDOZEbits.IDLEN = 1;
+	
+	//Hold off the ISR, wakes resume here instead, and the UART is fed in the loop
+	uint8_t gie = INTCON0bits.GIE;
+	INTCON0bits.GIE = 0;
+	
+	//Enable Timer0, 8-bit, 1:1 postscaler
+	T0CON0 = 0x80;
+	
+	//While loop to count up to input delay
+	while(ms--){
+		
+		//For loop to count 4 periods
+		//Gives 1000us = 1ms per loop
+		for(uint8_t i = 0; i < 4; i++){
+			
+			//Idle until the period match
+			while(!PIR3bits.TMR0IF){
+				SLEEP();
+				NOP();
+				LATENCY_EDGES(0);
+				UART_DRAIN();
+			}
+			
+			PIR3bits.TMR0IF = 0;
+		}
+	}
+	
+	//Disable timer and wake, restore IDLEN
+	T0CON0 &= 0x7F;
+	PIE3bits.TMR0IE = 0;
+	CPUDOZEbits.IDLEN = idlen;
+	
+	INTCON0bits.GIE = gie;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to start a non-blocking timeout
+//Takes in number of ms to wait, clamped to 1 through MAX_TIMEOUT_MS
+//Runs Timer0 in 16-bit mode at FOSC/4 with a 1:256 prescaler, 16us per count
+//Preloads the timer so it overflows after the requested time
+//Shares Timer0 with DelayMs, so don't call DelayMs while a timeout is pending
+//Returns status
+SystemStatus StartTimeout(uint16_t ms){
+	
+	//Validate 1 <= ms <= MAX_TIMEOUT_MS
+	if(ms < 1){
+		ms = 1;
+	}
+	
+	if(ms > MAX_TIMEOUT_MS){
+		ms = MAX_TIMEOUT_MS;
+	}
+	
+	//Convert ms to 16us counts, 62.5 counts per ms
+	uint16_t counts = (uint16_t) (((uint32_t) ms * 125) >> 1);
+	
+	//Disable timer while reconfiguring
+	T0CON0 = 0x00;
+	
+	//Set 1:256 prescaler, FOSC/4
+	T0CON1 = 0x48;
+	
+	//Preload so the timer overflows after counts
+	//HI byte is buffered until LO byte is written
+	TMR0H = ((0 - counts) >> 8) & 0x00FF;
+	TMR0L = (0 - counts) & 0x00FF;
+	
+	//Clear overflow flag
+	PIR3bits.TMR0IF = 0;
+	
+	//Enable timer in 16-bit mode, 1:1 postscaler
+	T0CON0 = 0x90;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to check for timeout completion
+//Takes in a pointer to the timeout "boolean"
+//Sets timeout to 1 and stops Timer0 once it has overflowed
+//Returns status
+SystemStatus CheckTimeout(uint8_t* timeout){
+	
+	//Check overflow flag
+	if(PIR3bits.TMR0IF == 1){
+		
+		//Stop timer, timeout finished
+		T0CON0 &= 0x7F;
+		*timeout = 1;
+	} else {
+		
+		//Still waiting
+		*timeout = 0;
+	}
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
 //Function to initialize SPI1
 //No inputs
 //Configures for max baud and slew
@@ -314,7 +613,7 @@ SystemStatus Spi1TxInit(void){
 	SPI1CON0bits.EN = 0;
     
 	//Set baud rate and slew rate to max
-    SPI1BAUD = 0;
+    SPI1BAUD = SPI_BAUD;
     SLRCONB = 0x00;
 	
 	//Set RB4 to SDA and RB6 to SCK
@@ -336,12 +635,9 @@ SystemStatus Spi1TxInit(void){
     SPI1CON2bits.TXR = 1;
     SPI1CON2bits.RXR = 0;
     
-    DelayMs(5);
-    
 	//Enable SPI1
+	//Nothing is sent for SPI_SETTLE_MS, St7789InitStart's reset hold covers it
     SPI1CON0bits.EN = 1;
-    
-    DelayMs(10);
 	
 	//Return OK
 	return SYSTEM_OK;
@@ -354,6 +650,11 @@ SystemStatus Spi1TxInit(void){
 //Repeats until finished
 //Returns OK
 SystemStatus Spi1Send(uint8_t* data, uint8_t length){
+	//Leaf of every render chain, so the deepest return stack is seen here
+	STACK_PROBE();
+	SPI_MODEL_COUNT(length);
+	LATENCY_SEND();
+	
 	//Iterand
     uint8_t i = 0;
     
@@ -393,3 +694,439 @@ SystemStatus Spi1Send(uint8_t* data, uint8_t length){
 	//Return OK
 	return SYSTEM_OK;
 }
+
+//Function to send one byte pair repeatedly over SPI1
+//Takes in the hi and lo bytes and how many times to send the pair
+//Writes straight into the FIFO, no buffer, so a 16-bit color can fill any window
+//A write that hits a full FIFO sets TXWE and is lost, so wait for empty and resend it
+//Returns OK
+SystemStatus Spi1SendRepeat(uint8_t hi, uint8_t lo, uint16_t count){
+	//Leaf of the streamed render chain
+	STACK_PROBE();
+	SPI_MODEL_COUNT((uint32_t) count << 1);
+	LATENCY_SEND();
+	
+	//Which byte of the pair is next, 0 for hi
+	uint8_t phase = 0;
+	
+	while(count){
+		
+		//Shove the next byte into the buffer
+		SPI1TXB = phase ? lo : hi;
+		
+		//If it was dropped, wait for room and resend it
+		if(SPI1STATUSbits.TXWE){
+			while(!SPI1STATUSbits.TXBE){
+				
+			}
+			
+			SPI1STATUSbits.TXWE = 0;
+			continue;
+		}
+		
+		//Pair done after the lo byte
+		if(phase){
+			count--;
+		}
+		
+		phase ^= 0x01;
+	}
+	
+	//Wait for the FIFO to empty, so DC isn't changed under the last bytes
+	while(!SPI1STATUSbits.TXBE){
+		
+	}
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to start a frame time measurement
+//Takes no inputs
+//Clears the SPI byte counts and starts Timer1 at FOSC/4, 1:8, 0.5us per count
+//Timer1 is otherwise unused, so this can run alongside DelayMs and StartTimeout
+//Returns OK
+SystemStatus SpiModelStart(void){
+	
+	//Timer off, no gate, FOSC/4
+	T1CON = 0x00;
+	T1GCON = 0x00;
+	T1CLK = 0x01;
+	
+	//Reset count
+	TMR1H = 0;
+	TMR1L = 0;
+	
+#ifdef PW_FRAME_MODEL
+	spi_model_bytes = 0;
+	spi_model_calls = 0;
+#endif
+	
+	//1:8 prescaler, 16-bit reads, on
+	T1CON = 0x33;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to end a frame time measurement
+//Takes pointers to the predicted and measured frame times in us
+//Predicted is SPI time from the counted bytes and sends, each byte costing the slower of
+//the wire and the FIFO loop, so it tracks SPI_BAUD and the clock set by ClockInit
+//Measured is Timer1 since SpiModelStart, wrapping past 32767us
+//Measured minus predicted is CPU work outside SPI
+//Predicted is 0 unless built with PW_FRAME_MODEL
+//Returns status
+SystemStatus SpiModelEnd(uint16_t* predicted_us, uint16_t* measured_us){
+	
+	//Validate input
+	if(predicted_us == NULL || measured_us == NULL){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	//Stop timer, low byte first latches the high byte
+	T1CON = 0x00;
+	uint16_t ticks = TMR1L;
+	ticks |= (uint16_t) TMR1H << 8;
+	
+	*measured_us = ticks >> 1;
+	
+	//Per-byte cost is whichever is slower, the wire or the loop feeding it
+	uint32_t cycles = (SPI_TRANSFER_CYCLES > SPI_CYCLES_PER_BYTE) ? SPI_TRANSFER_CYCLES : SPI_CYCLES_PER_BYTE;
+	cycles = cycles * SPI_MODEL_BYTES + (uint32_t) SPI_CYCLES_PER_CALL * SPI_MODEL_CALLS;
+	cycles /= MIPS;
+	
+	*predicted_us = (cycles > 0xFFFF) ? 0xFFFF : (uint16_t) cycles;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+#ifdef PW_LATENCY
+//Function to start input latency measurement
+//Takes in the object whose draw shows a press, usually the player's Sprite, NULL for any draw
+//Starts Timer3 free running at 16us per count, wrapping after about 1s, and clears totals
+//Arms IOC on every button's falling edge and enables interrupts, LatencyIocIsr stamps presses
+//Hooks are compiled in only with PW_LATENCY
+//Returns OK
+SystemStatus LatencyInit(const void* watch){
+	
+	//Timer off, no gate, 500kHz MFINTOSC
+	T3CON = 0x00;
+	T3GCON = 0x00;
+	T3CLK = 0x05;
+	
+	TMR3H = 0;
+	TMR3L = 0;
+	
+	//1:8 prescaler, 16-bit reads, on
+	T3CON = 0x33;
+	
+	latency_watch = watch;
+	latency_state = LATENCY_IDLE;
+	latency_count = 0;
+	latency_min = 0xFFFF;
+	latency_max = 0;
+	latency_sum = 0;
+	latency_min_frames = 0xFF;
+	latency_max_frames = 0;
+	latency_sum_frames = 0;
+	
+	//Presses pull the pins LO, stamp on the falling edge
+	IOCCN |= BUTTON_PINS;
+	IOCCF = 0;
+	PIE0bits.IOCIE = 1;
+	INTCON0bits.GIE = 1;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to stamp button press edges
+//Takes in the buttons whose IOC flags are left set, for WaitTick's wake check, 0 for none
+//Called from LatencyIocIsr, and from the idle loops where GIE is held off
+//An edge while no sample is open stamps Timer3 and the frame, so the wait until the
+//next poll is part of the sample
+//Edges during an open sample, bounces included, are ignored, one sample at a time
+//Returns OK
+SystemStatus LatencyEdges(uint8_t keep){
+	
+	//Button edges since the last call
+	uint8_t edges = IOCCF & BUTTON_PINS;
+	
+	if(edges == 0){
+		return SYSTEM_OK;
+	}
+	
+	if(latency_state == LATENCY_IDLE){
+		latency_stamp = TMR3L;
+		latency_stamp |= (uint16_t) TMR3H << 8;
+		latency_frame_stamp = latency_frames;
+		latency_state = LATENCY_PRESSED;
+	}
+	
+	//Clear only the flags read, an edge since then stays pending
+	IOCCF ^= edges & ~keep;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to close a latency sample
+//Takes no inputs
+//Called by LATENCY_SEND at the first SPI byte after the watched object's draw armed it
+//Adds the time and frames since the press to the totals
+//Returns OK
+SystemStatus LatencySample(void){
+	
+	//Counts since the press, unsigned wrap handles Timer3 rolling over
+	uint16_t now = TMR3L;
+	now |= (uint16_t) TMR3H << 8;
+	uint16_t elapsed = now - latency_stamp;
+	uint8_t frames = latency_frames - latency_frame_stamp;
+	
+	if(elapsed < latency_min){
+		latency_min = elapsed;
+	}
+	
+	if(elapsed > latency_max){
+		latency_max = elapsed;
+	}
+	
+	if(frames < latency_min_frames){
+		latency_min_frames = frames;
+	}
+	
+	if(frames > latency_max_frames){
+		latency_max_frames = frames;
+	}
+	
+	latency_sum += elapsed;
+	latency_sum_frames += frames;
+	latency_count++;
+	
+	latency_state = LATENCY_IDLE;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to report input latency
+//Takes a pointer to the stats to fill
+//Gives min, mean and max from the press edge to first SPI byte of the response, in us and frames
+//All zero if no sample has closed
+//Returns status
+SystemStatus LatencyReport(LatencyStats* stats){
+	
+	//Validate input
+	if(stats == NULL){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	stats->count = latency_count;
+	
+	if(latency_count == 0){
+		stats->min_us = 0;
+		stats->mean_us = 0;
+		stats->max_us = 0;
+		stats->min_frames = 0;
+		stats->mean_frames = 0;
+		stats->max_frames = 0;
+		return SYSTEM_OK;
+	}
+	
+	stats->min_us = (uint32_t) latency_min * LATENCY_US_PER_COUNT;
+	stats->mean_us = (latency_sum / latency_count) * LATENCY_US_PER_COUNT;
+	stats->max_us = (uint32_t) latency_max * LATENCY_US_PER_COUNT;
+	stats->min_frames = latency_min_frames;
+	stats->mean_frames = latency_sum_frames / latency_count;
+	stats->max_frames = latency_max_frames;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//IOC interrupt, a button edge on PORTC
+void __interrupt(irq(IOC), base(8)) LatencyIocIsr(void){
+	LatencyEdges(0);
+}
+#endif
+
+//Function to read a frame time measurement without ending it
+//Takes a pointer to the time since SpiModelStart in us
+//Lets a frame be split into phases while Timer1 keeps running
+//Returns status
+SystemStatus SpiModelElapsed(uint16_t* measured_us){
+	
+	//Validate input
+	if(measured_us == NULL){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	//Low byte first latches the high byte
+	uint16_t ticks = TMR1L;
+	ticks |= (uint16_t) TMR1H << 8;
+	
+	*measured_us = ticks >> 1;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+#ifdef PW_TELEMETRY
+//Function to initialize UART1 for telemetry
+//Takes no inputs
+//TX only on RA4, 8N1 at 115200, see UART_BRG
+//Enables interrupts, Uart1TxIsr feeds the FIFO from the ring buffer
+//Returns OK
+SystemStatus Uart1TxInit(void){
+	
+	//Set A4 as digital output for TX, idle HI
+	TRISA4 = 0;
+	ANSELA4 = 0;
+	LATA4 = 1;
+	RA4PPS = UART_TX_PPS;
+	
+	//Async 8-bit, high speed baud, TX on
+	U1CON0 = 0xA0;
+	U1BRGH = UART_BRG >> 8;
+	U1BRGL = UART_BRG & 0xFF;
+	U1CON2 = 0x00;
+	
+	//Enable UART1
+	U1CON1 = 0x80;
+	
+	uart_head = 0;
+	uart_tail = 0;
+	
+	//TX interrupt is enabled only while the ring has data
+	PIE4bits.U1TXIE = 0;
+	INTCON0bits.GIE = 1;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to queue bytes for UART1
+//Takes in the data and its length
+//Copies into the ring buffer and returns at once, never waits on the UART
+//Drops the whole message if it doesn't fit, so records are never cut
+//Returns status, SYSTEM_FAILED_OP if dropped
+SystemStatus Uart1Queue(uint8_t* data, uint8_t length){
+	
+	//Validate input
+	if(data == NULL){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	//Free space, one byte kept empty to tell full from empty
+	uint8_t space = (uart_tail - uart_head - 1) & (UART_RING - 1);
+	
+	if(length > space){
+		return SYSTEM_FAILED_OP;
+	}
+	
+	for(uint8_t i = 0; i < length; i++){
+		uart_ring[uart_head] = data[i];
+		uart_head = (uart_head + 1) & (UART_RING - 1);
+	}
+	
+	//Start sending
+	PIE4bits.U1TXIE = 1;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to move queued bytes into the UART1 FIFO
+//Takes no inputs
+//Sends while the FIFO has room, then turns the TX interrupt off once the ring is empty
+//Called from Uart1TxIsr and from the idle loops while the ISR is held off
+//Returns OK
+SystemStatus Uart1Drain(void){
+	
+	while(uart_tail != uart_head && PIR4bits.U1TXIF){
+		U1TXB = uart_ring[uart_tail];
+		uart_tail = (uart_tail + 1) & (UART_RING - 1);
+	}
+	
+	if(uart_tail == uart_head){
+		PIE4bits.U1TXIE = 0;
+	}
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//UART1 TX interrupt, the FIFO has room
+void __interrupt(irq(U1TX), base(8)) Uart1TxIsr(void){
+	Uart1Drain();
+}
+#endif
+
+//Function to report hardware return stack use
+//Takes pointers to the high-water level and overflow "boolean"
+//High water is the deepest level STACK_PROBE saw, out of HW_STACK_LEVELS
+//Always 0 unless built with PW_STACK_PROBE
+//Overflowed is the sticky stack overflow or underflow flag from PCON0, cleared on read
+//Returns status
+SystemStatus StackReport(uint8_t* high_water, uint8_t* overflowed){
+	
+	//Validate input
+	if(high_water == NULL || overflowed == NULL){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	*high_water = STACK_HIGH_WATER;
+	*overflowed = (PCON0bits.STKOVF || PCON0bits.STKUNF);
+	
+	//Clear flags for the next report
+	PCON0bits.STKOVF = 0;
+	PCON0bits.STKUNF = 0;
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to paint a data stack region
+//Takes a pointer to the start of the region and its length
+//Region comes from the map file, the software stack only exists in the reentrant model
+//Call once at boot before the stack grows into it
+//Returns status
+SystemStatus StackPaint(uint8_t* start, uint16_t length){
+	
+	//Validate input
+	if(start == NULL){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	//Fill with paint
+	for(uint16_t i = 0; i < length; i++){
+		start[i] = STACK_PAINT;
+	}
+	
+	//Return OK
+	return SYSTEM_OK;
+}
+
+//Function to measure unused data stack
+//Takes the same region given to StackPaint and a pointer to the unused byte count
+//The PIC18 software stack grows up, so paint left at the end was never touched
+//Returns status
+SystemStatus StackUnused(uint8_t* start, uint16_t length, uint16_t* unused){
+	
+	//Validate input
+	if(start == NULL || unused == NULL){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	//Count paint from the end down
+	*unused = 0;
+	
+	while(*unused < length && start[length - 1 - *unused] == STACK_PAINT){
+		(*unused)++;
+	}
+	
+	//Return OK
+	return SYSTEM_OK;
+}
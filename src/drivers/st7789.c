@@ -10,122 +10,166 @@ const uint8_t display_on = 0x29;
 const uint8_t col_address = 0x2A;
 const uint8_t row_address = 0x2B;
 const uint8_t memory_write = 0x2C;
+const uint8_t scroll_define = 0x33;
+const uint8_t scroll_start = 0x37;
 
 const uint8_t access = 0x40;
 const uint8_t format = 0x55;
 
 const uint8_t span[4] = {0x00, 0x00, 0x00, 0xEF};
 
-//Function to initialize ST7789
+//Bring-up state, see St7789InitStep
+static uint8_t init_state = ST7789_INIT_IDLE;
+
+void St7789InitSend(uint8_t dc, const uint8_t* byte);
+
+//Function to send a single init byte
+//Takes the DC level and a pointer to the byte
+//Waits for SPI to go idle so DC isn't changed mid-byte
+void St7789InitSend(uint8_t dc, const uint8_t* byte){
+	
+	//Set DC, 0 for command, 1 for data
+	LATB5 = dc;
+	SPI1TXB = *byte;
+	
+	while(SPI1CON2bits.BUSY){
+		
+	}
+	
+	//Allow buffer to clear
+	while(!SPI1STATUSbits.TXBE){
+		
+	}
+}
+
+//Function to begin initializing the ST7789
 //Takes no input
-//Sends various init commands and data
-//Returns OK
-SystemStatus St7789Init(void){
+//Triggers the hardware reset and starts the first timeout
+//The reset hold also gives SPI1 its SPI_SETTLE_MS after Spi1TxInit
+//The rest of the sequence is advanced by St7789InitStep
+//Returns status
+SystemStatus St7789InitStart(void){
 	
 	//Pull reset low, triggering hardware reset
 	LATB7 = 0;
-    DelayMs(10);
-    
-	//Release reset, allowing interaction
-    LATB7 = 1;
-    DelayMs(120);
-    
-	//DC to command, software reset
-    LATB5 = 0;
-    DelayMs(5);
-    SPI1TXB = soft_reset;
-    
-    while(SPI1CON2bits.BUSY){
-        
-    }
-    
-    DelayMs(120);
-    
-	//End sleep mode
-    SPI1TXB = sleep_out;
-    while(SPI1CON2bits.BUSY){
-        
-    }
-    
-    DelayMs(120);
-    
-    //Sets refresh and addressing directions
-    SPI1TXB = access_control;
-    
-    while(SPI1CON2bits.BUSY){
-        
-    }
-    
-    DelayMs(5);
-    
-	//DC to data
-	//Sets to top to bottom, left to right
-    LATB5 = 1;
-    DelayMs(5);
-    SPI1TXB = access;
-    
-    while(SPI1CON2bits.BUSY){
-        
-    }
-    
-    DelayMs(5);
-    
-	//Quick delay to allow buffer to empty
-    while(!SPI1STATUSbits.TXBE){
-        
-    }
-    
-    DelayMs(5);
-    
-	//DC to command, RGB format select
-    LATB5 = 0;
-    SPI1TXB = format_select;
-    
-    while(SPI1CON2bits.BUSY){
-        
-    }
-    
-    DelayMs(5);
-    
-	//DC to data, select 16-bit format
-    LATB5 = 1;
-    DelayMs(5);
-    SPI1TXB = format;
-    
-    while(SPI1CON2bits.BUSY){
-        
-    }
-    
-    DelayMs(5);
-    
-	//DC to command, turn on inversion
-	//This actually turns off inversion, go figure
-    LATB5 = 0;
-    DelayMs(5);
-    SPI1TXB = inverted;
-    
-    while(SPI1CON2bits.BUSY){
-        
-    }
-    
-    DelayMs(5);
-    
-	//Turn on display
-    SPI1TXB = display_on;
-    
-    while(SPI1CON2bits.BUSY){
-        
-    }
-    
-    DelayMs(5);
-    
-    //Allow buffer to clear
-     while(!SPI1STATUSbits.TXBE){
-        
-    }
-    
-	//Clear screen and return status upstream
-    return St7789Clear();
+	init_state = ST7789_INIT_RESET;
+	
+	//Hold reset for 10ms, plus the SPI settle time
+	return StartTimeout(10 + SPI_SETTLE_MS);
+}
+
+//Function to advance ST7789 initialization
+//Takes a pointer to the ready "boolean"
+//Does nothing until the current timeout finishes, then sends the next step
+//Timeouts are only those the panel requires, nothing blocks the CPU
+//Sets ready to 1 once the panel is cleared and on
+//Returns status
+SystemStatus St7789InitStep(uint8_t* ready){
+	
+	//Timeout placeholder
+	uint8_t timeout = 0;
+	
+	//Status placeholder
+	SystemStatus status = SYSTEM_OK;
+	
+	*ready = (init_state == ST7789_INIT_READY);
+	
+	//Nothing to do if finished or never started
+	if(init_state == ST7789_INIT_READY || init_state == ST7789_INIT_IDLE){
+		return SYSTEM_OK;
+	}
+	
+	//Wait for the current step's timeout
+	CheckTimeout(&timeout);
+	
+	if(!timeout){
+		return SYSTEM_OK;
+	}
+	
+	switch(init_state){
+		
+		//Release reset, allowing interaction
+		case ST7789_INIT_RESET:
+			LATB7 = 1;
+			init_state = ST7789_INIT_RELEASE;
+			return StartTimeout(120);
+		
+		//Software reset
+		case ST7789_INIT_RELEASE:
+			St7789InitSend(0, &soft_reset);
+			init_state = ST7789_INIT_SOFT_RESET;
+			return StartTimeout(120);
+		
+		//End sleep mode
+		case ST7789_INIT_SOFT_RESET:
+			St7789InitSend(0, &sleep_out);
+			init_state = ST7789_INIT_SLEEP_OUT;
+			return StartTimeout(120);
+		
+		//Configure and clear the panel, then turn it on
+		case ST7789_INIT_SLEEP_OUT:
+			
+			//Sets refresh and addressing directions
+			//Top to bottom, left to right
+			St7789InitSend(0, &access_control);
+			St7789InitSend(1, &access);
+			
+			//Select 16-bit format
+			St7789InitSend(0, &format_select);
+			St7789InitSend(1, &format);
+			
+			//Turn on inversion
+			//This actually turns off inversion, go figure
+			St7789InitSend(0, &inverted);
+			
+			//Mark ready first so St7789Flash doesn't wait on itself
+			init_state = ST7789_INIT_READY;
+			
+			//Clear while the display is still off, no garbage flash
+			if((status = St7789Clear()) != SYSTEM_OK){
+				return status;
+			}
+			
+			//Turn on display
+			St7789InitSend(0, &display_on);
+			
+			*ready = 1;
+			return SYSTEM_OK;
+		
+		default:
+			return SYSTEM_UNKNOWN_ERROR;
+	}
+}
+
+//Function to initialize ST7789
+//Takes no input
+//Blocks until the whole init sequence is finished
+//Prefer St7789InitStart and St7789InitStep to overlap other setup
+//Returns status
+SystemStatus St7789Init(void){
+	
+	//Ready placeholder
+	uint8_t ready = 0;
+	
+	//Status placeholder
+	SystemStatus status = SYSTEM_OK;
+	
+	//Start sequence if not already started
+	if(init_state == ST7789_INIT_IDLE){
+		if((status = St7789InitStart()) != SYSTEM_OK){
+			return status;
+		}
+	}
+	
+	//Step until ready, return error if error
+	while(!ready){
+		if((status = St7789InitStep(&ready)) != SYSTEM_OK){
+			return status;
+		}
+	}
+	
+	//Return OK
+	return SYSTEM_OK;
 }
 
 //Function to send a command to the ST7789
@@ -156,43 +200,46 @@ SystemStatus St7789Data(uint8_t* data, uint16_t length){
 
 //Function to set every pixel on the ST7789 to one color
 //Takes hi and lo bytes of the color
-//Addresses the whole screen
-//Sends color 57600 times
+//Fills the whole screen with St7789Fill
 //Returns SystemStatus
 SystemStatus St7789Flash(uint8_t color_hi, uint8_t color_lo){
 	
-	uint8_t color[2];
-	
-	color[0] = color_hi;
-	color[1] = color_lo;
+	return St7789Fill(0, SCREEN_LAST, 0, SCREEN_LAST, color_hi, color_lo);
+}
+
+//Function to fill a window with one color
+//Takes in start and end row and column
+//Takes hi and lo bytes of the color
+//Opens the window once, then streams the color with St7789Color
+//Returns SystemStatus
+SystemStatus St7789Fill(uint8_t start_row, uint8_t end_row, uint8_t start_col, uint8_t end_col, uint8_t color_hi, uint8_t color_lo){
 	
 	//Status placeholder
 	SystemStatus status = SYSTEM_OK;
 	
-	//Set column address space to whole screen
-	St7789Cmd(&col_address);
-    St7789Data(span, 4);
-    
-	//Set row address space to whole screen
-    St7789Cmd(&row_address);
-    St7789Data(span, 4);
-    
-	//Write command
-    St7789Cmd(&memory_write);
-    
-	//For loop to iterate through every pixel
-    for(uint8_t i = 0; i < 240; i++){
-        for(uint8_t j = 0; j < 240; j++){
-			
-			//Send data, early return if error
-            if((status = St7789Data(color, 2)) != SYSTEM_OK){
-				return status;
-			}
-        }
-    }
+	//Total pixels in the window, at most 57600
+	uint16_t pixels = (uint16_t) (end_row - start_row + 1) * (uint16_t) (end_col - start_col + 1);
+	
+	//Open the window, if error return error
+	if((status = St7789Window(start_row, end_row, start_col, end_col)) != SYSTEM_OK){
+		return status;
+	}
 	
-	//Return status
-	return status;
+	//Stream the color and return status
+	return St7789Color(color_hi, color_lo, pixels);
+}
+
+//Function to send pixels of one color into the open window
+//Takes hi and lo bytes of the color and the pixel count
+//Streams straight into the SPI FIFO, no color buffer
+//Returns SystemStatus
+SystemStatus St7789Color(uint8_t color_hi, uint8_t color_lo, uint16_t pixels){
+	
+	//Set DC to data
+	LATB5 = 1;
+	
+	//Send and return status upstream
+	return Spi1SendRepeat(color_hi, color_lo, pixels);
 }
 
 //Function to set every pixel on the ST7789 to black
@@ -204,12 +251,22 @@ SystemStatus St7789Clear(void){
 	return St7789Flash(0x00, 0x00);
 }
 
-//Function to draw an image to the screen
+//Function to open a window for writing
 //Takes in start and end row and column
-//Takes in pointer to 16-bit RGB artwork and length
-//Formats data and sends to ST7789 using St7789Data
+//Sends column and row address spaces, then begins a memory write
+//Any St7789Data after this fills the window, row by row
 //Passes SystemStatus upstream
-SystemStatus St7789Draw(uint8_t start_row, uint8_t end_row, uint8_t start_col, uint8_t end_col, uint8_t* art, uint8_t length){
+SystemStatus St7789Window(uint8_t start_row, uint8_t end_row, uint8_t start_col, uint8_t end_col){
+	
+	//Status placeholder
+	SystemStatus status = SYSTEM_OK;
+	
+	//Finish bring-up first if anything draws early
+	if(init_state != ST7789_INIT_READY){
+		if((status = St7789Init()) != SYSTEM_OK){
+			return status;
+		}
+	}
 	
 	//Build 4-Byte row and column data
 	uint8_t rows[4] = {0};
@@ -228,9 +285,74 @@ SystemStatus St7789Draw(uint8_t start_row, uint8_t end_row, uint8_t start_col, u
 	St7789Cmd(&row_address);
 	St7789Data(rows, 4);
 	
-	//Begin write
-	St7789Cmd(&memory_write);
+	//Begin write and return status
+	return St7789Cmd(&memory_write);
+}
+
+//Function to draw an image to the screen
+//Takes in start and end row and column
+//Takes in pointer to 16-bit RGB artwork and length
+//Opens the window and sends the art using St7789Data
+//Passes SystemStatus upstream
+SystemStatus St7789Draw(uint8_t start_row, uint8_t end_row, uint8_t start_col, uint8_t end_col, uint8_t* art, uint8_t length){
+	
+	//Status placeholder
+	SystemStatus status = SYSTEM_OK;
+	
+	//Open the window, if error return error
+	if((status = St7789Window(start_row, end_row, start_col, end_col)) != SYSTEM_OK){
+		return status;
+	}
 	
 	//Write and return status
 	return St7789Data(art, length);
 }
+
+//Function to define the vertical scroll area
+//Takes in top fixed, scrolling and bottom fixed line counts
+//The three must add up to FRAME_LINES
+//Sends VSCRDEF
+//Returns SystemStatus
+SystemStatus St7789ScrollArea(uint16_t top_fixed, uint16_t scroll_lines, uint16_t bottom_fixed){
+	
+	//Validate areas cover the frame memory exactly
+	if(top_fixed + scroll_lines + bottom_fixed != FRAME_LINES){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	//Build 6-Byte area data, HI byte first
+	uint8_t area[6];
+	
+	area[0] = (top_fixed >> 8) & 0x00FF;
+	area[1] = top_fixed & 0x00FF;
+	area[2] = (scroll_lines >> 8) & 0x00FF;
+	area[3] = scroll_lines & 0x00FF;
+	area[4] = (bottom_fixed >> 8) & 0x00FF;
+	area[5] = bottom_fixed & 0x00FF;
+	
+	//Transmit and return status
+	St7789Cmd(&scroll_define);
+	return St7789Data(area, 6);
+}
+
+//Function to set the vertical scroll start address
+//Takes in the frame memory line to show at the top of the scroll area
+//Sends VSCSAD
+//Returns SystemStatus
+SystemStatus St7789ScrollStart(uint16_t line){
+	
+	//Validate line is in frame memory
+	if(line >= FRAME_LINES){
+		return SYSTEM_INVALID_INPUT;
+	}
+	
+	//Build 2-Byte line data, HI byte first
+	uint8_t start[2];
+	
+	start[0] = (line >> 8) & 0x00FF;
+	start[1] = line & 0x00FF;
+	
+	//Transmit and return status
+	St7789Cmd(&scroll_start);
+	return St7789Data(start, 2);
+}
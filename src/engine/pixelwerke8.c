@@ -1,27 +1,62 @@
 #include "pixelwerke8.h"
 
-//Struct to store information relating to the running instance of the engine
-struct EngineInstance{
-	//Max sprites to be allowed in this game instance
-	//Max max is defined in pixelwerke8.h
-	uint8_t max_sprites;
-	
-	//[0..7] are undefined
-	uint8_t engine_flags;
-	
-	//Array of all sprites in the game
-	Sprite* sprites;
-};
+//Default engine context, and the one every engine call acts on
+//Games with one context never need to change it
+static EngineInstance default_instance;
+static EngineInstance* instance = &default_instance;
+
+//Telemetry for the frame being built, see PWTelemetrySend
+#ifdef PW_TELEMETRY
+static uint16_t telemetry_frame = 0;
+static uint16_t telemetry_phases[TELEMETRY_PHASES];
+static uint8_t telemetry_collisions = 0;
+
+//TELEMETRY_STATE_BYTES must match, it's counted in the RAM budget in pixelwerke8.h
+typedef char pw_telemetry_budget[(sizeof(telemetry_frame) + sizeof(telemetry_phases) + sizeof(telemetry_collisions) == TELEMETRY_STATE_BYTES) ? 1 : -1];
+
+#define TELEMETRY_COLLISION() telemetry_collisions++
+#else
+#define TELEMETRY_COLLISION()
+#endif
+
+//Compile-time checks, an array of negative size fails the build
+//Sprite must stay packed to SPRITE_BYTES
+typedef char pw_sprite_packed[(sizeof(Sprite) == SPRITE_BYTES) ? 1 : -1];
+
+//Default context, its pointer and note bank must leave 32 bytes of PW_STATIC_RESERVE for driver and renderer state
+//PW_MAX_SPRITES itself is checked against PW_SPRITES_FIT in pixelwerke8.h
+typedef char pw_ram_budget[(sizeof(EngineInstance) + sizeof(instance) + sizeof(note_bank) + 32 <= PW_STATIC_RESERVE) ? 1 : -1];
+
+//Powers of ten for HUD digits, most significant first
+static const uint16_t HUD_POWERS[HUD_MAX_DIGITS] = {10000, 1000, 100, 10, 1};
 
-//Instantiate instance and flags
-static EngineInstance instance;
-static GameFlags flags;
+EngineStatus PWCameraDrawColumns(uint8_t first, uint8_t count);
+EngineStatus PWCameraRestore(Sprite* sprite);
+uint8_t PWBoxesOverlap(Sprite* a, Sprite* b);
+uint8_t PWMasksOverlap(Sprite* a, Sprite* b, const CollisionMask* a_mask, const CollisionMask* b_mask);
+uint16_t PWMaskRow(Sprite* sprite, const CollisionMask* mask, uint8_t row);
+uint8_t PWPairCollides(uint8_t i, uint8_t j);
+EngineStatus PWStepAddress(uint16_t* address, uint8_t direction);
+uint8_t PWFootprintSolid(uint16_t address, uint8_t sprite_flags);
+uint8_t PWRedrawPending(Sprite* sprite);
+EngineStatus PWWriteMessage(uint8_t** message, uint8_t* str_lens, uint8_t length);
+EngineStatus PWMessageBox(uint8_t* str_lens, uint8_t length, uint8_t* box);
 
 //Function to initialize game instance
-//Takes number of sprites, flag byte, and pointer to sprite array
+//Takes number of sprites, at most PW_MAX_SPRITES, flag byte, and pointer to sprite array
+//Starts display bring-up, then initializes audio while the panel waits
+//Call PWEngineReady while setting up the game to finish bring-up
 //Returns EngineStatus
 EngineStatus PWEngineInit(uint8_t sprites_needed, uint8_t flags, Sprite* sprite_array, uint8_t* notes, uint8_t* colors){
 	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Attempt to set up the selected context, if error return error
+	if((status = PWContextInit(instance, sprites_needed, flags, sprite_array)) != ENGINE_OK){
+		return status;
+	}
+	
 	if(notes == NULL){
 		notes = NOTES;
 	}
@@ -30,25 +65,210 @@ EngineStatus PWEngineInit(uint8_t sprites_needed, uint8_t flags, Sprite* sprite_
 		colors = DEFAULT_COLORS;
 	}
 	
-	instance.max_sprites = sprites_needed;
-	instance.engine_flags = flags;
-	instance.sprites = sprite_array;
-	
 	PW8MonoInit(colors);
 	AudioInit(notes);
 	
 	return ENGINE_OK;
 }
 
+//Function to initialize an engine context
+//Takes the context, number of sprites, at most PW_MAX_SPRITES, flag byte, and pointer to sprite array
+//Fills only the context, the shared renderer, scroll and audio state are left alone
+//Use on a game-owned context before PWEngineSelect, PWEngineInit does this for the selected one
+//Returns EngineStatus
+EngineStatus PWContextInit(EngineInstance* context, uint8_t sprites_needed, uint8_t flags, Sprite* sprite_array){
+	
+	//Validate sprite count against compile-time capacity
+	if(sprites_needed > PW_MAX_SPRITES){
+		return ENGINE_MAX_SPRITES_EXCEEDED | ENGINE_INVALID_INPUT;
+	}
+	
+	if(context == NULL || (sprite_array == NULL && sprites_needed != 0)){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	context->max_sprites = sprites_needed;
+	context->active_sprites = sprites_needed;
+	context->engine_flags = flags;
+	context->sprites = sprite_array;
+	context->world = NULL;
+	context->camera_x = 0;
+	context->camera_y = 0;
+	context->masks = NULL;
+	context->mask_count = 0;
+	context->solid = NULL;
+	context->redraw_cursor = 0;
+	
+	return ENGINE_OK;
+}
+
+//Function to advance engine bring-up
+//Takes in a pointer to the ready "boolean"
+//Steps the renderer's display init, never blocks
+//Sets ready to 1 once the first frame can be drawn
+//Drawing before then still works, it just waits for the panel
+//Returns EngineStatus
+EngineStatus PWEngineReady(uint8_t* ready){
+	
+	if(ready == NULL){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Attempt to step renderer init, if error return error
+	if((status = PW8MonoInitStep(ready)) != ENGINE_OK){
+		return ENGINE_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to test two Sprites' bounding boxes
+//Takes in the two Sprites
+//Uses the renderer's layout, [15..8] of the address is x and width runs along it
+//Address bytes 128-255 are negative, like the renderer
+//Returns 1 if the boxes share any tile, 0 if not
+uint8_t PWBoxesOverlap(Sprite* a, Sprite* b){
+	
+	//Parse signed addresses
+	int8_t ax = (int8_t) ((a->address >> 8) & 0x00FF);
+	int8_t ay = (int8_t) (a->address & 0x00FF);
+	int8_t bx = (int8_t) ((b->address >> 8) & 0x00FF);
+	int8_t by = (int8_t) (b->address & 0x00FF);
+	
+	//Check each edge against the other's far edge, sizes are 2-5 tiles
+	return !((ax + ((a->sprite_flags >> 4) & 0x03) + 2 <= bx) ||
+			(bx + ((b->sprite_flags >> 4) & 0x03) + 2 <= ax) ||
+			(ay + ((a->sprite_flags >> 6) & 0x03) + 2 <= by) ||
+			(by + ((b->sprite_flags >> 6) & 0x03) + 2 <= ay));
+}
+
+//Function to test two Sprites' collision masks
+//Takes in the two Sprites and their masks, boxes must already overlap
+//Walks the shared logical pixel rows, shifting one row into the other's frame and ANDing
+//Returns 1 if any set pixels overlap, 0 if not
+uint8_t PWMasksOverlap(Sprite* a, Sprite* b, const CollisionMask* a_mask, const CollisionMask* b_mask){
+	
+	//Parse signed addresses in logical pixels, 2 per tile
+	int16_t ax = (int8_t) ((a->address >> 8) & 0x00FF) * TILE_SIZE;
+	int16_t ay = (int8_t) (a->address & 0x00FF) * TILE_SIZE;
+	int16_t bx = (int8_t) ((b->address >> 8) & 0x00FF) * TILE_SIZE;
+	int16_t by = (int8_t) (b->address & 0x00FF) * TILE_SIZE;
+	
+	//Parse widths in logical pixels
+	int16_t a_end = ax + (((a->sprite_flags >> 4) & 0x03) + 2) * TILE_SIZE;
+	int16_t b_end = bx + (((b->sprite_flags >> 4) & 0x03) + 2) * TILE_SIZE;
+	
+	//Shared rows along x
+	int16_t first = (ax > bx) ? ax : bx;
+	int16_t last = (a_end < b_end) ? a_end : b_end;
+	
+	//Offset of b from a along y, at most a mask row apart after the box test
+	int16_t dy = by - ay;
+	
+	//Placeholder for b's shifted row
+	uint16_t row = 0;
+	
+	for(int16_t x = first; x < last; x++){
+		
+		//Shift b's row into a's frame
+		row = PWMaskRow(b, b_mask, x - bx);
+		row = (dy >= 0) ? (row >> dy) : (row << -dy);
+		
+		//Any shared set pixel is a hit
+		if(PWMaskRow(a, a_mask, x - ax) & row){
+			return 1;
+		}
+	}
+	
+	//Return no hit
+	return 0;
+}
+
+//Function to read a mask row as the Sprite is drawn
+//Takes in the Sprite, its mask and the row, relative to the Sprite
+//Mirrors the mask by the Sprite's SPRITE_FLIP_X/Y bits, so flipped Sprites share one mask
+//Returns the row, MSB is y = 0
+uint16_t PWMaskRow(Sprite* sprite, const CollisionMask* mask, uint8_t row){
+	
+	//Sprite size in logical pixels
+	uint8_t rows = (((sprite->sprite_flags >> 4) & 0x03) + 2) * TILE_SIZE;
+	uint8_t cols = (((sprite->sprite_flags >> 6) & 0x03) + 2) * TILE_SIZE;
+	
+	//Mirror along x by reading rows from the far end
+	if(sprite->animation & SPRITE_FLIP_X){
+		row = rows - 1 - row;
+	}
+	
+	uint16_t bits = mask->rows[row];
+	
+	//Mirror along y by reversing the row's used bits
+	if(sprite->animation & SPRITE_FLIP_Y){
+		uint16_t reversed = 0;
+		
+		for(uint8_t i = 0; i < cols; i++){
+			reversed = (reversed >> 1) | (bits & 0x8000);
+			bits <<= 1;
+		}
+		
+		bits = reversed;
+	}
+	
+	return bits;
+}
+
+//Function to set collision masks
+//Takes in a table of masks indexed by Sprite animation and its length
+//NULL entries, or animations past the end, collide by bounding box only
+//Pass NULL to go back to bounding boxes for everything
+//Returns EngineStatus
+EngineStatus PWSetCollisionMasks(const CollisionMask** masks, uint8_t count){
+	
+	instance->masks = masks;
+	instance->mask_count = (masks == NULL) ? 0 : count;
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to test one pair of Sprites for collision
+//Takes in the two Sprites' indices
+//Checks bounding boxes, then masks if both objects have one
+//Returns 1 if they collide, 0 if not
+uint8_t PWPairCollides(uint8_t i, uint8_t j){
+	
+	//Check bounding boxes first, most pairs stop here
+	if(!PWBoxesOverlap(&instance->sprites[i], &instance->sprites[j])){
+		return 0;
+	}
+	
+	//Look up masks, if any
+	uint8_t i_anim = instance->sprites[i].animation & ANIMATION_MASK;
+	uint8_t j_anim = instance->sprites[j].animation & ANIMATION_MASK;
+	const CollisionMask* i_mask = (i_anim < instance->mask_count) ? instance->masks[i_anim] : NULL;
+	const CollisionMask* j_mask = (j_anim < instance->mask_count) ? instance->masks[j_anim] : NULL;
+	
+	//Bounding box is enough unless both have masks
+	if(i_mask == NULL || j_mask == NULL){
+		return 1;
+	}
+	
+	return PWMasksOverlap(&instance->sprites[i], &instance->sprites[j], i_mask, j_mask);
+}
+
 //Function to detect collisions
 //Takes starting index as input
 //Takes pointer to colliders
 //Modifies colliders parameter in place such that [15..8] is the first object's index, and [7..0] is the second
 //Returns EngineStatus
-//Access sprite array and checks for matching addresses of collidable objects
+//Access sprite array and checks collision layers, then geometry, of collidable objects
+//Pairs are skipped unless each one's category is in the other's collides with
 EngineStatus PWDetectCollisions(uint8_t start, uint16_t* colliders){
 	
-	if(start >= instance.max_sprites){
+	if(start >= instance->max_sprites){
 		return ENGINE_MAX_SPRITES_EXCEEDED | ENGINE_INVALID_INPUT;
 	}
 	
@@ -57,34 +277,89 @@ EngineStatus PWDetectCollisions(uint8_t start, uint16_t* colliders){
 	}
 	
 	//Cycle through sprites for the first object
-	for(uint8_t i = start; i < instance.max_sprites - 1; i++){
+	for(uint8_t i = start; i < instance->max_sprites - 1; i++){
 		
 		//Check if first object can collide
-		if(!(instance.sprites[i].sprite_flags & 0x01)){
+		if(!(instance->sprites[i].sprite_flags & 0x01)){
 			continue;
 		}
 		
 		//Cycle through sprites for the second object
-		for(uint8_t j = i + 1; j < instance.max_sprites; j++){
+		for(uint8_t j = i + 1; j < instance->max_sprites; j++){
 			
 			//Check if second object can collide
-			if(!(instance.sprites[j].sprite_flags & 0x01)){
+			if(!(instance->sprites[j].sprite_flags & 0x01)){
 				continue;
 			}
 			
-			//Check address x plus width and address y plus height vs address of other
-			if(!(((instance.sprites[i].address & 0x00FF) + ((instance.sprites[i].sprite_flags & 0x30) >> 4) < (instance.sprites[j].address & 0x00FF)) ||
-				((instance.sprites[j].address & 0x00FF) + ((instance.sprites[j].sprite_flags & 0x30) >> 4) < (instance.sprites[i].address & 0x00FF)) ||
-				(((instance.sprites[i].address & 0xFF00) >> 8) + ((instance.sprites[i].sprite_flags & 0xC0) >> 6) < ((instance.sprites[j].address & 0xFF00) >> 8)) ||
-				(((instance.sprites[j].address & 0xFF00) >> 8) + ((instance.sprites[j].sprite_flags & 0xC0) >> 6) < ((instance.sprites[i].address & 0xFF00) >> 8)))){
-					
-				//Set colliders to indices as described above
-				*colliders = (i << 8) | j;
-				
-				//Return collision detected
-				return ENGINE_COLLISION_DETECTED;
+			//Check layers before any geometry
+			if(!((instance->sprites[i].layers >> 4) & instance->sprites[j].layers & 0x0F) ||
+				!((instance->sprites[j].layers >> 4) & instance->sprites[i].layers & 0x0F)){
+				continue;
 			}
-				
+			
+			//Check geometry
+			if(!PWPairCollides(i, j)){
+				continue;
+			}
+			
+			//Set colliders to indices as described above
+			*colliders = (i << 8) | j;
+			TELEMETRY_COLLISION();
+			
+			//Return collision detected
+			return ENGINE_COLLISION_DETECTED;
+		}
+	}
+	
+	//Return OK if not found
+	return ENGINE_OK;
+}
+
+//Function to detect collisions between two sets of collision layers
+//Takes starting index, the first and second objects' categories, and pointer to colliders
+//Modifies colliders parameter in place such that [15..8] is the first object's index, and [7..0] is the second
+//Only first objects in first_category are tested, and only against second objects in second_category
+//Categories are 4-bit, like Sprite layers, and collides with is ignored, the query picks the layers
+//Call again with start one past the first object to keep searching
+//Returns EngineStatus
+EngineStatus PWDetectCollisionsBetween(uint8_t start, uint8_t first_category, uint8_t second_category, uint16_t* colliders){
+	
+	if(start >= instance->max_sprites){
+		return ENGINE_MAX_SPRITES_EXCEEDED | ENGINE_INVALID_INPUT;
+	}
+	
+	if(colliders == NULL){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Cycle through sprites for the first object
+	for(uint8_t i = start; i < instance->max_sprites; i++){
+		
+		//Check if first object can collide and is in the first set
+		if(!(instance->sprites[i].sprite_flags & 0x01) || !((instance->sprites[i].layers >> 4) & first_category)){
+			continue;
+		}
+		
+		//Cycle through every other sprite for the second object
+		for(uint8_t j = 0; j < instance->max_sprites; j++){
+			
+			//Check if second object can collide and is in the second set
+			if(j == i || !(instance->sprites[j].sprite_flags & 0x01) || !((instance->sprites[j].layers >> 4) & second_category)){
+				continue;
+			}
+			
+			//Check geometry
+			if(!PWPairCollides(i, j)){
+				continue;
+			}
+			
+			//Set colliders to indices as described above
+			*colliders = (i << 8) | j;
+			TELEMETRY_COLLISION();
+			
+			//Return collision detected
+			return ENGINE_COLLISION_DETECTED;
 		}
 	}
 	
@@ -100,7 +375,7 @@ EngineStatus PWDetectCollisions(uint8_t start, uint16_t* colliders){
 EngineStatus PWRepackSprites(uint8_t old_count, uint8_t* new_count){
 	
 	//Validate input
-	if(old_count > instance.max_sprites){
+	if(old_count > instance->max_sprites){
 		return ENGINE_INVALID_INPUT | ENGINE_MAX_SPRITES_EXCEEDED;
 	}
 	
@@ -115,13 +390,13 @@ EngineStatus PWRepackSprites(uint8_t old_count, uint8_t* new_count){
 	for(uint8_t read = 1; read < old_count; read++){
 		
 		//Check each sprite for life
-		if(instance.sprites[read].sprite_flags & 0x04){
+		if(instance->sprites[read].sprite_flags & 0x04){
 			
 			//If alive and read and write are not equal
 			if(write != read){
 				
 				//Copy sprite from dead index to live index
-				instance.sprites[write] = instance.sprites[read];
+				instance->sprites[write] = instance->sprites[read];
 			}
 		}
 		
@@ -131,6 +406,190 @@ EngineStatus PWRepackSprites(uint8_t old_count, uint8_t* new_count){
 	
 	//Write = last live sprite + 1 = total sprites
 	*new_count = write;
+	instance->active_sprites = write;
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to step an address one tile in a direction
+//Takes in a pointer to the address and the direction
+//Directions start at 000 N and move clockwise to 111 NW
+//Returns EngineStatus
+EngineStatus PWStepAddress(uint16_t* address, uint8_t direction){
+	
+	//Extract x and y data from address
+	uint8_t y = (*address & 0x00FF);
+	uint8_t x = (*address >> 8) & 0x00FF;
+	
+	//Extract direction from velocity
+	switch(direction & 0x07){
+		//000 -> N
+		case 0:
+			y--;
+			break;
+		//001 -> NE
+		case 1:
+			x++;
+			y--;
+			break;
+		//010 -> E
+		case 2:
+			x++;
+			break;
+		//011 -> SE
+		case 3:
+			x++;
+			y++;
+			break;
+		//100 -> S
+		case 4:
+			y++;
+			break;
+		//101 -> SW
+		case 5:
+			x--;
+			y++;
+			break;
+		//110 -> W
+		case 6:
+			x--;
+			break;
+		//111 -> NW
+		case 7:
+			x--;
+			y--;
+			break;
+		//Result of bitmask should be between 0 and 7 always
+		//If not, something has gone horribly wrong, return error
+		default:
+			return ENGINE_UNKNOWN_ERROR;
+			break;
+	}
+	
+	//Repack address in the layout it was parsed from
+	*address = ((uint16_t) x << 8) | y;
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to test a Sprite footprint against the solidity bitmap
+//Takes in the footprint's address and the Sprite flags that size it
+//Reads at most two bytes per row of the footprint
+//Tiles off the grid are open
+//Returns 1 if any covered tile is solid, 0 if not or no bitmap is set
+uint8_t PWFootprintSolid(uint16_t address, uint8_t sprite_flags){
+	
+	if(instance->solid == NULL){
+		return 0;
+	}
+	
+	//Parse signed address and size, like the renderer
+	int16_t x = (int8_t) ((address >> 8) & 0x00FF);
+	int16_t y = (int8_t) (address & 0x00FF);
+	int16_t x_last = x + ((sprite_flags >> 4) & 0x03) + 1;
+	int16_t y_last = y + ((sprite_flags >> 6) & 0x03) + 1;
+	
+	//Clip footprint to the grid
+	if(x < 0){
+		x = 0;
+	}
+	
+	if(y < 0){
+		y = 0;
+	}
+	
+	if(x_last > TILE_PIXEL_CONV_X){
+		x_last = TILE_PIXEL_CONV_X;
+	}
+	
+	if(y_last > TILE_PIXEL_CONV_Y){
+		y_last = TILE_PIXEL_CONV_Y;
+	}
+	
+	if(x > x_last || y > y_last){
+		return 0;
+	}
+	
+	//Mask of the covered bits in a 16-bit window starting at byte y >> 3
+	//At most 5 tiles from bit 7, so two bytes always cover it
+	uint16_t mask = (uint16_t) (0xFFFF << (16 - (y_last - y + 1))) >> (y & 0x07);
+	
+	//Pointer to the first row's window
+	const uint8_t* row = instance->solid + x * SOLID_ROW_BYTES + (y >> 3);
+	
+	//Only read a second byte if the footprint reaches it, so the last row never reads past the map
+	uint8_t wide = (mask & 0x00FF) != 0;
+	
+	//Placeholder for each row's window
+	uint16_t bits = 0;
+	
+	for(; x <= x_last; x++){
+		
+		bits = ((uint16_t) row[0] << 8) | (wide ? row[1] : 0);
+		
+		if(bits & mask){
+			return 1;
+		}
+		
+		row += SOLID_ROW_BYTES;
+	}
+	
+	//Return open
+	return 0;
+}
+
+//Function to set the solidity bitmap
+//Takes in a pointer to the bitmap, or NULL to turn solidity off
+//One row of SOLID_ROW_BYTES per tile along x, MSB first along y, 1 is solid
+//Can live in flash
+//While set, PWMoveSprites refuses moves into solid tiles
+//Returns EngineStatus
+EngineStatus PWSetSolidity(const uint8_t* solid){
+	
+	instance->solid = solid;
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to check a Sprite against the solidity bitmap
+//Takes in the Sprite and a pointer to the blocked "boolean"
+//Sets blocked to 1 if the Sprite overlaps any solid tile
+//Returns EngineStatus
+EngineStatus PWCheckSolid(Sprite* sprite, uint8_t* blocked){
+	
+	if(sprite == NULL || blocked == NULL){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	*blocked = PWFootprintSolid(sprite->address, sprite->sprite_flags);
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to check a Sprite's next move against the solidity bitmap
+//Takes in the Sprite and a pointer to the blocked "boolean"
+//Sets blocked to 1 if one step along its velocity would overlap a solid tile
+//Returns EngineStatus
+EngineStatus PWCheckMove(Sprite* sprite, uint8_t* blocked){
+	
+	if(sprite == NULL || blocked == NULL){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Placeholders for stepping
+	uint16_t address = sprite->address;
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Attempt to step, if error return error
+	if((status = PWStepAddress(&address, sprite->velocity)) != ENGINE_OK){
+		return status;
+	}
+	
+	*blocked = PWFootprintSolid(address, sprite->sprite_flags);
 	
 	//Return OK
 	return ENGINE_OK;
@@ -140,80 +599,75 @@ EngineStatus PWRepackSprites(uint8_t old_count, uint8_t* new_count){
 //Takes in current count of sprites
 //Returns EngineStatus
 //Updates all sprites in the instance based on velocity
+//Speed is added to each Sprite's phase, and it only moves when the phase passes a full tile
+//Speed 0 moves every call, like games written before speed was honored
+//Sprites stay put if the solidity bitmap blocks their move
+//Only Sprites that move are cleared and marked for redraw
 //Directions start at 000 N and move clockwise to 111 NW
 EngineStatus PWMoveSprites(uint8_t sprite_count){
 	
 	//Validate input
-	if(sprite_count > instance.max_sprites){
+	if(sprite_count > instance->max_sprites){
 		return ENGINE_MAX_SPRITES_EXCEEDED | ENGINE_INVALID_INPUT;
 	}
 	
-	//Create x and y placeholders
-	uint8_t x = 0;
-	uint8_t y = 0;
+	//Remember the live count for the engine's own walks
+	instance->active_sprites = sprite_count;
+	
+	//Create address, phase and status placeholders
+	uint16_t address = 0;
+	uint8_t speed = 0;
+	uint8_t phase = 0;
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
 	
 	//Iterate through all sprites
 	for(uint8_t i = 0; i < sprite_count; i++){
 		
 		//Skip if immobile or dead
-		if((instance.sprites[i].sprite_flags & 0x0C) != 0x0C){
+		if((instance->sprites[i].sprite_flags & 0x0C) != 0x0C){
+			continue;
+		}
+		
+		//Skip if culled by the camera, it isn't on screen to clear
+		if((instance->engine_flags & ENGINE_FLAG_CAMERA) && !(instance->sprites[i].sprite_flags & 0x02)){
+			continue;
+		}
+		
+		//Advance phase, skip if it hasn't reached a full tile
+		speed = instance->sprites[i].velocity >> 3;
+		
+		if(speed != 0){
+			phase = (instance->sprites[i].phase & PHASE_MASK) + speed;
+			instance->sprites[i].phase = (instance->sprites[i].phase & ~PHASE_MASK) | (phase & PHASE_MASK);
+			
+			if(phase < PHASE_FULL){
+				continue;
+			}
+		}
+		
+		//Step address, if error return error
+		address = instance->sprites[i].address;
+		
+		if((status = PWStepAddress(&address, instance->sprites[i].velocity)) != ENGINE_OK){
+			return status;
+		}
+		
+		//Skip if blocked, nothing to clear since it won't move
+		if(PWFootprintSolid(address, instance->sprites[i].sprite_flags)){
 			continue;
 		}
 		
 		//Clear Sprite animation, since it's moving
-		PW8MonoClearSprite(&instance.sprites[i]);
-		
-		//Extract x and y data from address
-		y = (instance.sprites[i].address & 0x00FF);
-		x = (instance.sprites[i].address >> 8) & 0x00FF;
-		
-		//Extract direction from velocity
-		switch(instance.sprites[i].velocity & 0x07){
-			//000 -> N
-			case 0:
-				y--;
-				break;
-			//001 -> NE
-			case 1:
-				x++;
-				y--;
-				break;
-			//010 -> E
-			case 2:
-				x++;
-				break;
-			//011 -> SE
-			case 3:
-				x++;
-				y++;
-				break;
-			//100 -> S
-			case 4:
-				y++;
-				break;
-			//101 -> SW
-			case 5:
-				x--;
-				y++;
-				break;
-			//110 -> W
-			case 6:
-				x--;
-				break;
-			//111 -> NW
-			case 7:
-				x--;
-				y--;
-				break;
-			//Result of bitmask should be between 0 and 7 always
-			//If not, something has gone horribly wrong, return error
-			default:
-				return ENGINE_UNKNOWN_ERROR;
-				break;
-		}
-		
-		//Repack address and save
-		instance.sprites[i].address = ((uint16_t) y << 8) | x;
+		//In world mode put the map back instead of leaving an OFF hole in it
+		if(instance->world != NULL){
+			PWCameraRestore(&instance->sprites[i]);
+		} else {
+			PW8MonoClearSprite(&instance->sprites[i]);
+		}
+		
+		//Save new address and mark for redraw
+		instance->sprites[i].address = address;
+		instance->sprites[i].phase |= SPRITE_REDRAW;
 	}
 	
 	//Reached the end, return ok
@@ -222,28 +676,39 @@ EngineStatus PWMoveSprites(uint8_t sprite_count){
 
 //Function to redraw Sprites that have moved
 //Takes in sprite count
-//Iterates through Sprite array and redraws Sprites that have the mobile flag set
+//Iterates through Sprite array and redraws mobile Sprites marked for redraw
+//Slow Sprites cost nothing on frames they don't move
 //Returns status
 EngineStatus PWRedrawSprites(uint8_t sprite_count){
 	
 	//Validate input
-	if(sprite_count > instance.max_sprites){
+	if(sprite_count > instance->max_sprites){
 		return ENGINE_MAX_SPRITES_EXCEEDED | ENGINE_INVALID_INPUT;
 	}
 	
+	//Remember the live count for the engine's own walks
+	instance->active_sprites = sprite_count;
+	
 	//Status placeholder for error catching
 	EngineStatus status = 0;
 	
 	//Iterate through Sprite array
 	for(uint8_t i = 0; i < sprite_count; i++){
 		
-		//Check mobile flag
-		if(instance.sprites[i].sprite_flags & 0x08){
+		//Skip if culled by the camera
+		if((instance->engine_flags & ENGINE_FLAG_CAMERA) && !(instance->sprites[i].sprite_flags & 0x02)){
+			continue;
+		}
+		
+		//Check mobile flag and redraw pending
+		if((instance->sprites[i].sprite_flags & 0x08) && (instance->sprites[i].phase & SPRITE_REDRAW)){
 			
 			//Attempt to redraw, if error return error
-			if((status = PW8MonoDrawSprite(&instance.sprites[i])) != ENGINE_OK){
+			if((status = PW8MonoDrawSprite(&instance->sprites[i])) != ENGINE_OK){
 				return status;
 			}
+			
+			instance->sprites[i].phase &= ~SPRITE_REDRAW;
 		}
 	}
 	
@@ -251,53 +716,200 @@ EngineStatus PWRedrawSprites(uint8_t sprite_count){
 	return ENGINE_OK;
 }
 
-//Function to erase a Sprite
-//Takes in a pointer to the Sprite to erase
-//Calls ClearSprite from the renderer
-//Returns status
-EngineStatus PWEraseSprite(Sprite* sprite){
-	
-	//Status placeholder
-	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+//Function to check if a Sprite is waiting to be redrawn
+//Takes in a pointer to the Sprite
+//Same test as PWRedrawSprites, mobile, marked, and not culled by the camera
+//Returns 1 if waiting, 0 if not
+uint8_t PWRedrawPending(Sprite* sprite){
 	
-	//Erase Sprite, if error return error
-	if((status = PW8MonoClearSprite(sprite)) != ENGINE_OK){
-		return ENGINE_DOWNSTREAM_ERROR | status;
+	//Skip if culled by the camera
+	if((instance->engine_flags & ENGINE_FLAG_CAMERA) && !(sprite->sprite_flags & 0x02)){
+		return 0;
 	}
 	
-	//Return OK
-	return ENGINE_OK;
+	return (sprite->sprite_flags & 0x08) && (sprite->phase & SPRITE_REDRAW);
 }
 
-//Function to play a tone
-//Takes in tone to play
-//Calls audio function directly
+//Function to redraw Sprites within the frame's time budget
+//Takes in sprite count, the Timer2 counts to keep for the rest of the frame, and a pointer to the deferred count
+//First redraws one waiting Sprite from the cursor on, whatever the budget, then moves the cursor past it
+//The cursor sweeps every Sprite, so a deferred Sprite waits at most sprite_count frames
+//Then redraws by priority, 0 first, until TickRemaining falls to reserve
+//Sprites left waiting keep their mark and are counted in deferred
+//Movement doesn't wait on drawing, so game speed holds and only the picture lags
 //Returns status
-EngineStatus PWPlayTone(uint8_t tone){
+EngineStatus PWRedrawSpritesBudget(uint8_t sprite_count, uint8_t reserve, uint8_t* deferred){
 	
-	//Placeholder status
-	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	//Validate input
+	if(sprite_count > instance->max_sprites){
+		return ENGINE_MAX_SPRITES_EXCEEDED | ENGINE_INVALID_INPUT;
+	}
 	
-	//Attempt to play tone, if error return error
-	if((status = PlayTone(tone)) != ENGINE_OK){
-		return ENGINE_DOWNSTREAM_ERROR | status;
+	if(deferred == NULL){
+		return ENGINE_INVALID_INPUT;
 	}
 	
-	//Return OK
-	return ENGINE_OK;
-}
-
-//Function to rest or play silence
-//No inputs
-//Calls audio silence function directly
-//Returns status
-EngineStatus PWSilence(void){
+	//Remember the live count for the engine's own walks
+	instance->active_sprites = sprite_count;
 	
-	//Placeholder status
+	//Status placeholder for error catching
 	EngineStatus status = ENGINE_UNKNOWN_ERROR;
 	
-	//Attempt to silence, if error return error
-	if((status = Silence()) != ENGINE_OK){
+	*deferred = 0;
+	
+	if(sprite_count == 0){
+		return ENGINE_OK;
+	}
+	
+	//Guaranteed redraw, first waiting Sprite from the cursor on
+	uint8_t i = (instance->redraw_cursor < sprite_count) ? instance->redraw_cursor : 0;
+	
+	for(uint8_t n = 0; n < sprite_count; n++){
+		
+		if(PWRedrawPending(&instance->sprites[i])){
+			
+			//Attempt to redraw, if error return error
+			if((status = PW8MonoDrawSprite(&instance->sprites[i])) != ENGINE_OK){
+				return status;
+			}
+			
+			instance->sprites[i].phase &= ~SPRITE_REDRAW;
+			
+			//Next frame starts after this one
+			instance->redraw_cursor = i + 1;
+			break;
+		}
+		
+		i = (i + 1 < sprite_count) ? i + 1 : 0;
+	}
+	
+	//Frame time left
+	uint8_t remaining = 0;
+	
+	//Redraw by priority while the budget lasts
+	for(uint8_t p = 0; p < PRIORITY_LEVELS; p++){
+		for(i = 0; i < sprite_count; i++){
+			
+			if(!PWRedrawPending(&instance->sprites[i]) || ((instance->sprites[i].phase & SPRITE_PRIORITY) >> SPRITE_PRIORITY_SHIFT) != p){
+				continue;
+			}
+			
+			//Out of budget, defer
+			TickRemaining(&remaining);
+			
+			if(remaining <= reserve){
+				(*deferred)++;
+				continue;
+			}
+			
+			//Attempt to redraw, if error return error
+			if((status = PW8MonoDrawSprite(&instance->sprites[i])) != ENGINE_OK){
+				return status;
+			}
+			
+			instance->sprites[i].phase &= ~SPRITE_REDRAW;
+		}
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to set a Sprite's redraw priority
+//Takes in a pointer to the Sprite and the priority, below PRIORITY_LEVELS, 0 is drawn first
+//Only PWRedrawSpritesBudget uses it, PWRedrawSprites draws in array order
+//Returns status
+EngineStatus PWSetPriority(Sprite* sprite, uint8_t priority){
+	
+	if(sprite == NULL || priority >= PRIORITY_LEVELS){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	sprite->phase = (sprite->phase & ~SPRITE_PRIORITY) | (priority << SPRITE_PRIORITY_SHIFT);
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to set how a Sprite is mirrored
+//Takes in a pointer to the Sprite and any of SPRITE_FLIP_X and SPRITE_FLIP_Y
+//Marks the Sprite for redraw if it changed
+//Returns status
+EngineStatus PWSetFlip(Sprite* sprite, uint8_t flip){
+	
+	if(sprite == NULL || (flip & ~(SPRITE_FLIP_X | SPRITE_FLIP_Y))){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	if((sprite->animation & (SPRITE_FLIP_X | SPRITE_FLIP_Y)) != flip){
+		sprite->animation = (sprite->animation & ANIMATION_MASK) | flip;
+		sprite->phase |= SPRITE_REDRAW;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to face a Sprite the way it moves
+//Takes in a pointer to the Sprite, whose art faces E
+//Directions with a W part flip along x, ones with an E part don't, N and S keep the last facing
+//Returns status
+EngineStatus PWFaceVelocity(Sprite* sprite){
+	
+	if(sprite == NULL){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	uint8_t direction = sprite->velocity & 0x07;
+	uint8_t flip = sprite->animation & (SPRITE_FLIP_X | SPRITE_FLIP_Y);
+	
+	//N and S, no change
+	if(direction == 0 || direction == 4){
+		return ENGINE_OK;
+	}
+	
+	//SW, W and NW
+	if(direction > 4){
+		flip |= SPRITE_FLIP_X;
+	} else {
+		flip &= ~SPRITE_FLIP_X;
+	}
+	
+	return PWSetFlip(sprite, flip);
+}
+
+//Function to mark a Sprite for redraw
+//Takes in a pointer to the Sprite
+//Use after changing a Sprite's art or address outside of PWMoveSprites
+//Returns status
+EngineStatus PWRequestRedraw(Sprite* sprite){
+	
+	if(sprite == NULL){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	sprite->phase |= SPRITE_REDRAW;
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to erase a Sprite
+//Takes in a pointer to the Sprite to erase
+//Calls ClearSprite from the renderer, or restores the map under it in world mode
+//Returns status
+EngineStatus PWEraseSprite(Sprite* sprite){
+	
+	//Status placeholder
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Put the map back in world mode, return error if error
+	if(instance->world != NULL){
+		return PWCameraRestore(sprite);
+	}
+	
+	//Erase Sprite, if error return error
+	if((status = PW8MonoClearSprite(sprite)) != ENGINE_OK){
 		return ENGINE_DOWNSTREAM_ERROR | status;
 	}
 	
@@ -305,12 +917,131 @@ EngineStatus PWSilence(void){
 	return ENGINE_OK;
 }
 
-//Function to display a message to the screen
+//Function to play a tone
+//Takes in tone to play
+//Calls audio function directly
+//Returns status
+EngineStatus PWPlayTone(uint8_t tone){
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Attempt to play tone, if error return error
+	if((status = PlayTone(tone)) != ENGINE_OK){
+		return ENGINE_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to rest or play silence
+//No inputs
+//Calls audio silence function directly
+//Returns status
+EngineStatus PWSilence(void){
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Attempt to silence, if error return error
+	if((status = Silence()) != ENGINE_OK){
+		return ENGINE_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to set up a HUD counter
+//Takes in the counter, the top-left logical address of its first digit, and its digit count
+//Nothing is drawn until the first PWHudSet
+//Returns status
+EngineStatus PWHudInit(HudCounter* hud, uint16_t address, uint8_t digits){
+	
+	//Validate input
+	if(hud == NULL || digits < 1 || digits > HUD_MAX_DIGITS){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	hud->address = address;
+	hud->digits = digits;
+	
+	//Mark every digit as never drawn
+	for(uint8_t i = 0; i < HUD_MAX_DIGITS; i++){
+		hud->shown[i] = HUD_BLANK;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to show a value on a HUD counter
+//Takes in the counter and the value, only the low digits are shown if it doesn't fit
+//Converts by subtracting powers of ten, no division on this part
+//Re-blits only digits that differ from what is on screen, usually just the last one
+//Returns status
+EngineStatus PWHudSet(HudCounter* hud, uint16_t value){
+	
+	//Validate input
+	if(hud == NULL || hud->digits < 1 || hud->digits > HUD_MAX_DIGITS){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Parse address to step for each digit
+	uint8_t x = (hud->address >> 8) & 0x00FF;
+	uint8_t y = hud->address & 0x00FF;
+	
+	//Placeholder for each digit
+	uint8_t digit = 0;
+	
+	//First power used, so the counter shows the low digits
+	uint8_t first = HUD_MAX_DIGITS - hud->digits;
+	
+	//Drop digits that don't fit
+	for(uint8_t i = 0; i < first; i++){
+		while(value >= HUD_POWERS[i]){
+			value -= HUD_POWERS[i];
+		}
+	}
+	
+	//Convert and draw each digit, most significant first
+	for(uint8_t i = 0; i < hud->digits; i++){
+		
+		//Count how many times the power fits
+		digit = 0;
+		
+		while(value >= HUD_POWERS[first + i]){
+			value -= HUD_POWERS[first + i];
+			digit++;
+		}
+		
+		//Skip digits already on screen
+		if(digit == hud->shown[i]){
+			continue;
+		}
+		
+		//Attempt to blit digit, if error return error
+		if((status = PW8MonoBlitChar(digit, ((uint16_t) (x + 5 * i) << 8) | y)) != ENGINE_OK){
+			return ENGINE_DOWNSTREAM_ERROR | status;
+		}
+		
+		hud->shown[i] = digit;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to write a message's lines, centered on screen
 //Takes in the message, an array of line lengths, and the number of lines
 //Validates number of lines will fit on screen
-//Calls WriteString for each line
+//Calls WriteString for each line, nothing is cleared first
 //Returns status
-EngineStatus PWDisplayMessage(uint8_t** message, uint8_t* str_lens, uint8_t length){
+EngineStatus PWWriteMessage(uint8_t** message, uint8_t* str_lens, uint8_t length){
 	
 	//Validate length, if error return error
 	if(length < 1 | length > ((SCREEN_RES_Y / PIXEL_SIZE) / 6)){
@@ -331,11 +1062,6 @@ EngineStatus PWDisplayMessage(uint8_t** message, uint8_t* str_lens, uint8_t leng
 	//Placeholder status
 	EngineStatus status = ENGINE_UNKNOWN_ERROR;
 	
-	//Clear screen, if error return error
-	if((status = PW8MonoClearScreen()) != ENGINE_OK){
-		return ENGINE_DOWNSTREAM_ERROR | status;
-	}
-	
 	//Iterate through each line in the message
 	for(uint8_t i = 0; i < length; i++){
 		
@@ -371,9 +1097,560 @@ EngineStatus PWDisplayMessage(uint8_t** message, uint8_t* str_lens, uint8_t leng
 	return ENGINE_OK;
 }
 
+//Function to display a message to the screen
+//Takes in the message, an array of line lengths, and the number of lines
+//Clears the whole screen, then writes the message with PWWriteMessage
+//Returns status
+EngineStatus PWDisplayMessage(uint8_t** message, uint8_t* str_lens, uint8_t length){
+	
+	//Validate length, if error return error
+	if(length < 1 | length > ((SCREEN_RES_Y / PIXEL_SIZE) / 6)){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Clear screen, if error return error
+	if((status = PW8MonoClearScreen()) != ENGINE_OK){
+		return ENGINE_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Write and return status
+	return PWWriteMessage(message, str_lens, length);
+}
+
+//Function to find a message's bounding box
+//Takes in the line lengths, the number of lines, and a pointer to the box
+//Uses the same centering as PWWriteMessage, plus a 1 logical pixel margin
+//Box is first x, last x, first y, last y in logical pixels
+//Returns ENGINE_FAILED_OP if every line is empty, there is nothing to box
+EngineStatus PWMessageBox(uint8_t* str_lens, uint8_t length, uint8_t* box){
+	
+	//Validate length, if error return error
+	if(length < 1 | length > ((SCREEN_RES_Y / PIXEL_SIZE) / 6)){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Widest line, every line is centered so it sets the box's width
+	uint8_t widest = 0;
+	
+	for(uint8_t i = 0; i < length; i++){
+		
+		//Validate line length, if error return error
+		if(str_lens[i] > ((SCREEN_RES_X / PIXEL_SIZE) / 5)){
+			return ENGINE_INVALID_INPUT;
+		}
+		
+		if(str_lens[i] > widest){
+			widest = str_lens[i];
+		}
+	}
+	
+	if(widest == 0){
+		return ENGINE_FAILED_OP;
+	}
+	
+	//Same centering as PWWriteMessage
+	uint8_t base_x = ((SCREEN_RES_X / PIXEL_SIZE) / 2) - 5 * (widest / 2);
+	uint8_t base_y = ((SCREEN_RES_Y / PIXEL_SIZE) / 2) - 6 * (length / 2);
+	
+	//Last line is 5 tall, no gap after it
+	box[0] = base_x;
+	box[1] = base_x + 5 * widest - 1;
+	box[2] = base_y;
+	box[3] = base_y + 6 * length - 2;
+	
+	//Add margin where it fits on screen
+	if(box[0] > 0){
+		box[0]--;
+	}
+	
+	if(box[1] < LOGICAL_LAST){
+		box[1]++;
+	}
+	
+	if(box[2] > 0){
+		box[2]--;
+	}
+	
+	if(box[3] < LOGICAL_LAST){
+		box[3]++;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to display a message over the game
+//Takes in the message, an array of line lengths, and the number of lines
+//Clears only the message's bounding box, then writes the message
+//The box is remembered so PWDismissOverlay can restore just that region
+//An overlay already up is dismissed first, so its box is never lost
+//Returns status
+EngineStatus PWDisplayOverlay(uint8_t** message, uint8_t* str_lens, uint8_t length){
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Attempt to restore the open overlay, if error return error
+	if((status = PWDismissOverlay()) != ENGINE_OK){
+		return status;
+	}
+	
+	//Find the box, nothing to show if every line is empty
+	if((status = PWMessageBox(str_lens, length, instance->overlay)) != ENGINE_OK){
+		return (status == ENGINE_FAILED_OP) ? ENGINE_OK : status;
+	}
+	
+	//Attempt to clear the box, if error return error
+	if((status = PW8MonoFillRect(instance->overlay[0], instance->overlay[1], instance->overlay[2], instance->overlay[3], 0)) != ENGINE_OK){
+		return ENGINE_DOWNSTREAM_ERROR | status;
+	}
+	
+	instance->engine_flags |= ENGINE_FLAG_OVERLAY;
+	
+	//Write and return status
+	return PWWriteMessage(message, str_lens, length);
+}
+
+//Function to remove the overlay message
+//No inputs
+//Restores the box from the world map if one is set, else clears it
+//Then redraws every live Sprite in the restored region
+//Returns status
+EngineStatus PWDismissOverlay(void){
+	
+	//Nothing to do if no overlay is up
+	if(!(instance->engine_flags & ENGINE_FLAG_OVERLAY)){
+		return ENGINE_OK;
+	}
+	
+	instance->engine_flags &= ~ENGINE_FLAG_OVERLAY;
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Region that was repainted, starts as the box
+	uint8_t x_start = instance->overlay[0];
+	uint8_t x_end = instance->overlay[1];
+	uint8_t y_start = instance->overlay[2];
+	uint8_t y_end = instance->overlay[3];
+	
+	if(instance->world != NULL){
+		
+		//Redraw the map columns under the box, if error return error
+		uint8_t first = x_start / TILE_SIZE;
+		uint8_t last = x_end / TILE_SIZE;
+		
+		if((status = PWCameraDrawColumns(first, last - first + 1)) != ENGINE_OK){
+			return status;
+		}
+		
+		//Whole columns were repainted, so Sprites anywhere in them need redrawing
+		x_start = first * TILE_SIZE;
+		x_end = last * TILE_SIZE + TILE_SIZE - 1;
+		y_start = 0;
+		y_end = LOGICAL_LAST;
+	} else {
+		
+		//Clear the box, if error return error
+		if((status = PW8MonoFillRect(instance->overlay[0], instance->overlay[1], instance->overlay[2], instance->overlay[3], 0)) != ENGINE_OK){
+			return ENGINE_DOWNSTREAM_ERROR | status;
+		}
+	}
+	
+	//Sprite extents in logical pixels
+	int16_t x = 0;
+	int16_t y = 0;
+	
+	//Redraw Sprites the box covered
+	for(uint8_t i = 0; i < instance->active_sprites; i++){
+		
+		//Skip if dead
+		if(!(instance->sprites[i].sprite_flags & 0x04)){
+			continue;
+		}
+		
+		//Skip if culled by the camera
+		if((instance->engine_flags & ENGINE_FLAG_CAMERA) && !(instance->sprites[i].sprite_flags & 0x02)){
+			continue;
+		}
+		
+		//Parse signed address in logical pixels
+		x = (int8_t) ((instance->sprites[i].address >> 8) & 0x00FF) * TILE_SIZE;
+		y = (int8_t) (instance->sprites[i].address & 0x00FF) * TILE_SIZE;
+		
+		//Skip if it misses the repainted region
+		if(x > x_end || x + ((((instance->sprites[i].sprite_flags >> 4) & 0x03) + 2) * TILE_SIZE) <= x_start ||
+			y > y_end || y + ((((instance->sprites[i].sprite_flags >> 6) & 0x03) + 2) * TILE_SIZE) <= y_start){
+			continue;
+		}
+		
+		//Attempt to redraw, if error return error
+		if((status = PW8MonoDrawSprite(&instance->sprites[i])) != ENGINE_OK){
+			return ENGINE_DOWNSTREAM_ERROR | status;
+		}
+		
+		instance->sprites[i].phase &= ~SPRITE_REDRAW;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to draw world columns from the camera
+//Takes in the first on-screen tile column and the number of columns
+//Streams each column straight from the flash map with PW8MonoDrawColumn
+//Returns status
+EngineStatus PWCameraDrawColumns(uint8_t first, uint8_t count){
+	
+	//Bytes per map column, padded to whole bytes
+	uint16_t stride = (instance->world->height + 1) >> 1;
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Pointer to the camera's top tile in the first column
+	const uint8_t* cells = instance->world->cells + (uint32_t) (instance->camera_x + first) * stride + (instance->camera_y >> 1);
+	
+	//Iterate through columns
+	for(uint8_t i = 0; i < count; i++){
+		
+		//Attempt to draw column, if error return error
+		if((status = PW8MonoDrawColumn(first + i, cells, instance->camera_y & 0x01)) != ENGINE_OK){
+			return ENGINE_DOWNSTREAM_ERROR | status;
+		}
+		
+		//Next column
+		cells += stride;
+	}
+	
+	//A full view covers every Sprite, so all of them need redrawing
+	if(first == 0 && count == VIEW_TILES_X){
+		for(uint8_t i = 0; i < instance->max_sprites; i++){
+			instance->sprites[i].phase |= SPRITE_REDRAW;
+		}
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to set the world map and camera
+//Takes in the map, or NULL to leave world mode, and the starting camera tile
+//Sets the whole screen as the scroll region and draws the full view
+//While a world is set, sprites are culled through PWCameraPlace
+//Returns status
+EngineStatus PWSetWorld(const WorldMap* world, uint16_t x, uint16_t y){
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Leave world mode
+	if(world == NULL){
+		instance->world = NULL;
+		instance->engine_flags &= ~ENGINE_FLAG_CAMERA;
+		
+		//Attempt to turn off scrolling, if error return error
+		if((status = PW8MonoSetScrollRegion(0, 0)) != ENGINE_OK){
+			return ENGINE_DOWNSTREAM_ERROR | status;
+		}
+		
+		return ENGINE_OK;
+	}
+	
+	//Validate the map covers the screen
+	if(world->cells == NULL || world->width < VIEW_TILES_X || world->height < VIEW_TILES_Y){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Clamp camera to the map
+	if(x > world->width - VIEW_TILES_X){
+		x = world->width - VIEW_TILES_X;
+	}
+	
+	if(y > world->height - VIEW_TILES_Y){
+		y = world->height - VIEW_TILES_Y;
+	}
+	
+	instance->world = world;
+	instance->camera_x = x;
+	instance->camera_y = y;
+	instance->engine_flags |= ENGINE_FLAG_CAMERA;
+	
+	//Attempt to scroll the whole screen, if error return error
+	if((status = PW8MonoSetScrollRegion(0, VIEW_TILES_X)) != ENGINE_OK){
+		return ENGINE_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Draw the full view
+	return PWCameraDrawColumns(0, VIEW_TILES_X);
+}
+
+//Function to pan the camera
+//Takes in the new camera tile, clamped to the map
+//Pans along x with hardware scroll and streams only the revealed columns
+//The panel only scrolls along x, so any y pan redraws the whole view
+//Returns status
+EngineStatus PWCameraMove(uint16_t x, uint16_t y){
+	
+	//Validate a world is set
+	if(instance->world == NULL){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Clamp camera to the map
+	if(x > instance->world->width - VIEW_TILES_X){
+		x = instance->world->width - VIEW_TILES_X;
+	}
+	
+	if(y > instance->world->height - VIEW_TILES_Y){
+		y = instance->world->height - VIEW_TILES_Y;
+	}
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Distance panned along x
+	int16_t dx = (int16_t) (x - instance->camera_x);
+	uint8_t exposed = 0;
+	
+	//Any y pan or a jump of a full screen redraws everything
+	if(y != instance->camera_y || dx >= VIEW_TILES_X || dx <= -VIEW_TILES_X){
+		instance->camera_x = x;
+		instance->camera_y = y;
+		return PWCameraDrawColumns(0, VIEW_TILES_X);
+	}
+	
+	//Nothing to do if the camera didn't move
+	if(dx == 0){
+		return ENGINE_OK;
+	}
+	
+	//Attempt to scroll, if error return error
+	if((status = PW8MonoScrollOffset((int8_t) dx, &exposed)) != ENGINE_OK){
+		return ENGINE_DOWNSTREAM_ERROR | status;
+	}
+	
+	instance->camera_x = x;
+	
+	//Stream only the revealed columns
+	return PWCameraDrawColumns(exposed, (dx < 0) ? -dx : dx);
+}
+
+//Function to place a Sprite in the world
+//Takes in the Sprite and its world tile address
+//Sets the on-screen address and in-play flag if any of the Sprite is in view
+//Partly visible Sprites get negative addresses and are clipped by the renderer
+//Clears the in-play flag if none of it is, culling it from moves and redraws
+//Returns status
+EngineStatus PWCameraPlace(Sprite* sprite, uint16_t world_x, uint16_t world_y){
+	
+	//Validate input
+	if(sprite == NULL || instance->world == NULL){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Sprite size in tiles, 2-5
+	uint8_t width = ((sprite->sprite_flags >> 4) & 0x03) + 2;
+	uint8_t height = ((sprite->sprite_flags >> 6) & 0x03) + 2;
+	
+	//Cull if all of it is outside the view
+	if((uint32_t) world_x + width <= instance->camera_x || world_x >= (uint32_t) instance->camera_x + VIEW_TILES_X ||
+		(uint32_t) world_y + height <= instance->camera_y || world_y >= (uint32_t) instance->camera_y + VIEW_TILES_Y){
+		
+		sprite->sprite_flags &= ~0x02;
+		return ENGINE_OK;
+	}
+	
+	//Convert to on-screen address
+	uint16_t address = (((world_x - instance->camera_x) & 0x00FF) << 8) | ((world_y - instance->camera_y) & 0x00FF);
+	
+	//Redraw if it moved on screen or just came into view
+	if(address != sprite->address || !(sprite->sprite_flags & 0x02)){
+		sprite->phase |= SPRITE_REDRAW;
+	}
+	
+	//Save and put in play
+	sprite->address = address;
+	sprite->sprite_flags |= 0x02;
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to restore the world map under a Sprite
+//Takes in the Sprite, at its on-screen address
+//Redraws each map tile its footprint covers, one DrawTile each like ClearSprite
+//Tiles outside the view are skipped, so partly visible Sprites are fine
+//Returns status
+EngineStatus PWCameraRestore(Sprite* sprite){
+	
+	//Validate input
+	if(sprite == NULL || instance->world == NULL){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Sprite size in tiles, 2-5
+	uint8_t width = ((sprite->sprite_flags >> 4) & 0x03) + 2;
+	uint8_t height = ((sprite->sprite_flags >> 6) & 0x03) + 2;
+	
+	//Bytes per map column, padded to whole bytes
+	uint16_t stride = (instance->world->height + 1) >> 1;
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Tile to draw and its art
+	Tile this_tile;
+	this_tile.size = TILE_SIZE;
+	uint8_t this_art = 0;
+	
+	//Placeholders for on-screen tile and map row
+	uint8_t x = 0;
+	uint8_t y = 0;
+	uint16_t row = 0;
+	
+	for(uint8_t i = 0; i < width; i++){
+		
+		//Wraps past 255 for negative addresses, skipped as off screen
+		x = ((sprite->address >> 8) + i) & 0x00FF;
+		
+		if(x > TILE_PIXEL_CONV_X){
+			continue;
+		}
+		
+		for(uint8_t j = 0; j < height; j++){
+			
+			y = ((sprite->address & 0x00FF) + j) & 0x00FF;
+			
+			if(y > TILE_PIXEL_CONV_Y){
+				continue;
+			}
+			
+			//Get HI or LO half of the map byte, as PW8MonoDrawColumn does
+			row = instance->camera_y + y;
+			this_art = instance->world->cells[(uint32_t) (instance->camera_x + x) * stride + (row >> 1)];
+			this_art = (row & 0x01) ? (this_art << 4) : (this_art & 0xF0);
+			
+			this_tile.address = ((uint16_t) x << 8) | y;
+			
+			//Draw Tile, if error return error
+			if((status = PW8MonoDrawTile(&this_tile, &this_art)) != ENGINE_OK){
+				return ENGINE_DOWNSTREAM_ERROR | status;
+			}
+		}
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
 //Function to return the running instance of the engine
 //Takes no inputs
 //Returns only a pointer to the running engine instance
 EngineInstance* PWEngineGetInstance(void){
-	return &instance;
+	return instance;
+}
+
+//Function to select the engine context
+//Takes in a pointer to a game-owned EngineInstance, or NULL for the default
+//Every engine call after this reads and writes only the selected context
+//Set up a fresh context with PWContextInit first, PWEngineInit once at boot brings up the panel and audio
+//The renderer, particle pool and audio drive the one panel and speaker, so they stay shared
+//Switching doesn't save them, a context picks up whatever scroll, clip and particles are live
+//Returns EngineStatus
+EngineStatus PWEngineSelect(EngineInstance* context){
+	
+	//NULL returns to the default
+	if(context == NULL){
+		context = &default_instance;
+	}
+	
+	instance = context;
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+#ifdef PW_TELEMETRY
+//Function to mark the end of a frame phase
+//Takes in the phase, below TELEMETRY_PHASES, for example update, render, audio
+//Stores the time since SpiModelStart, so call that at the top of each frame
+//Returns EngineStatus
+EngineStatus PWTelemetryPhase(uint8_t phase){
+	
+	if(phase >= TELEMETRY_PHASES){
+		return ENGINE_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	EngineStatus status = ENGINE_UNKNOWN_ERROR;
+	
+	//Attempt to read frame time, if error return error
+	if((status = SpiModelElapsed(&telemetry_phases[phase])) != ENGINE_OK){
+		return ENGINE_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
+}
+
+//Function to send the frame's telemetry record
+//Takes no inputs
+//Packs the record laid out in pixelwerke8.h and queues it for UART1, never waits
+//Clears phases and collisions for the next frame
+//Returns EngineStatus, ENGINE_FAILED_OP if the ring was full and the record dropped
+EngineStatus PWTelemetrySend(void){
+	
+	uint8_t record[TELEMETRY_BYTES];
+	
+	//Count Sprites alive
+	uint8_t alive = 0;
+	
+	for(uint8_t i = 0; i < instance->active_sprites; i++){
+		if(instance->sprites[i].sprite_flags & 0x04){
+			alive++;
+		}
+	}
+	
+	//Pack, LO first
+	record[0] = TELEMETRY_SYNC;
+	record[1] = telemetry_frame & 0xFF;
+	record[2] = telemetry_frame >> 8;
+	
+	for(uint8_t i = 0; i < TELEMETRY_PHASES; i++){
+		record[3 + (i << 1)] = telemetry_phases[i] & 0xFF;
+		record[4 + (i << 1)] = telemetry_phases[i] >> 8;
+		telemetry_phases[i] = 0;
+	}
+	
+	record[9] = SPI_MODEL_BYTES & 0xFF;
+	record[10] = (SPI_MODEL_BYTES >> 8) & 0xFF;
+	record[11] = (SPI_MODEL_BYTES >> 16) & 0xFF;
+	record[12] = (SPI_MODEL_BYTES >> 24) & 0xFF;
+	record[13] = SPI_MODEL_CALLS & 0xFF;
+	record[14] = SPI_MODEL_CALLS >> 8;
+	record[15] = alive;
+	record[16] = telemetry_collisions;
+	
+	//Checksum
+	record[17] = 0;
+	
+	for(uint8_t i = 1; i < TELEMETRY_BYTES - 1; i++){
+		record[17] += record[i];
+	}
+	
+	telemetry_frame++;
+	telemetry_collisions = 0;
+	
+	//Queue and return status, a full ring drops the record
+	if(Uart1Queue(record, TELEMETRY_BYTES) != ENGINE_OK){
+		return ENGINE_FAILED_OP;
+	}
+	
+	//Return OK
+	return ENGINE_OK;
 }
+#endif
@@ -1,10 +1,70 @@
+#include <stddef.h>
 #include "pixelwerke8_assets.h"
+#include "game_art.h"
 
 AssetStatus SpriteInit(Sprite* sprite, AssetAddress start_address, uint8_t type){
 	sprite->address = start_address;
 	sprite->velocity = 0x00;
 	sprite->sprite_flags = 0x04;
 	sprite->animation = type;
+	sprite->layers = (CATEGORY_DEFAULT << 4) | CATEGORY_ALL;
+	sprite->phase = SPRITE_REDRAW;
 	
 	return ASSET_STATUS_OK;
 }
+
+//Function to build a collision mask from Sprite art
+//Takes in the mask, and the type and flags the art is fetched with
+//Unpacks the same 4-bit Tile art the renderer draws into one row per logical pixel
+//Returns status
+AssetStatus MaskInit(CollisionMask* mask, uint8_t type, uint8_t sprite_flags){
+	
+	//Validate input
+	if(mask == NULL){
+		return ASSET_INVALID_INPUT;
+	}
+	
+	//Fetch art and size in tiles, 2-5
+	const uint8_t* art = GetSpriteArt(type, sprite_flags);
+	uint8_t height = ((sprite_flags >> 6) & 0x03) + 2;
+	uint8_t width = ((sprite_flags >> 4) & 0x03) + 2;
+	
+	//Placeholders for walking the art
+	uint8_t dex = 0;
+	uint8_t nibble = 0;
+	
+	//Start empty
+	for(uint8_t i = 0; i < MASK_MAX_ROWS; i++){
+		mask->rows[i] = 0;
+	}
+	
+	//Walk Tiles in draw order, left to right, top to bottom
+	for(uint8_t i = 0; i < width; i++){
+		for(uint8_t j = 0; j < height; j++){
+			
+			//Select HI or LO half of art byte
+			nibble = (dex & 0x01) ? (art[dex >> 1] & 0x0F) : (art[dex >> 1] >> 4);
+			dex++;
+			
+			//Bits [3..2] are the Tile's first row, [1..0] its second
+			if(nibble & 0x08){
+				mask->rows[i << 1] |= 0x8000 >> (j << 1);
+			}
+			
+			if(nibble & 0x04){
+				mask->rows[i << 1] |= 0x4000 >> (j << 1);
+			}
+			
+			if(nibble & 0x02){
+				mask->rows[(i << 1) + 1] |= 0x8000 >> (j << 1);
+			}
+			
+			if(nibble & 0x01){
+				mask->rows[(i << 1) + 1] |= 0x4000 >> (j << 1);
+			}
+		}
+	}
+	
+	//Return OK
+	return ASSET_STATUS_OK;
+}
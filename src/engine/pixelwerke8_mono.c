@@ -10,11 +10,54 @@ static uint8_t colors[4];
 //Default colors: black off, white on
 const uint8_t DEFAULT_COLORS[4] = {0x00, 0xFF, 0x00, 0xFF};
 
+//Hardware scroll region along x, in true pixels
+//scroll_lines of 0 means scrolling is off
+//scroll_offset is how far the region's content has moved toward x = 0
+static uint8_t scroll_top = 0;
+static uint8_t scroll_lines = 0;
+static uint8_t scroll_offset = 0;
+
+//Clip rectangle in tiles, inclusive, full screen by default
+static uint8_t clip_x_start = 0;
+static uint8_t clip_x_end = TILE_PIXEL_CONV_X;
+static uint8_t clip_y_start = 0;
+static uint8_t clip_y_end = TILE_PIXEL_CONV_Y;
+
+//Overdraw counts, see PW8MonoOverdrawRecord
+//Heat is pixel writes per OVERDRAW_CELL square, in on-screen space
+//Blank has a bit per cell, [x] row, MSB is y = 0, set while the whole cell is known OFF
+//Site is who the next PW8MonoFillWindow writes for, back to OVERDRAW_FILL after each
+#ifdef PW_OVERDRAW
+static uint16_t overdraw_heat[OVERDRAW_GRID][OVERDRAW_GRID];
+static uint8_t overdraw_blank[OVERDRAW_GRID];
+static OverdrawSite overdraw_sites[OVERDRAW_SITES];
+static uint8_t overdraw_site = OVERDRAW_FILL;
+
+//OVERDRAW_BYTES must match, it's counted in the RAM budget in pixelwerke8.h
+typedef char pw_overdraw_budget[(sizeof(overdraw_heat) + sizeof(overdraw_blank) + sizeof(overdraw_sites) + sizeof(overdraw_site) == OVERDRAW_BYTES) ? 1 : -1];
+
+void PW8MonoOverdrawRecord(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit, uint8_t site);
+
+#define OVERDRAW_RECORD(x_start, x_end, y_start, y_end, bit, site) PW8MonoOverdrawRecord(x_start, x_end, y_start, y_end, bit, site)
+#define OVERDRAW_SITE(site) overdraw_site = (site)
+#define OVERDRAW_FORGET() do{ for(uint8_t i = 0; i < OVERDRAW_GRID; i++){ overdraw_blank[i] = 0; } }while(0)
+#else
+#define OVERDRAW_RECORD(x_start, x_end, y_start, y_end, bit, site)
+#define OVERDRAW_SITE(site)
+#define OVERDRAW_FORGET()
+#endif
+
+uint8_t PW8MonoScrollRow(uint8_t x);
+uint8_t PW8MonoClipSprite(Sprite* sprite, uint8_t* i_start, uint8_t* i_end, uint8_t* j_start, uint8_t* j_end);
+RenderStatus PW8MonoFillWindow(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit);
+RenderStatus PW8MonoFillMapped(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit);
+RenderStatus PW8MonoExpandBits(uint8_t x, uint8_t y, const uint8_t* art, uint8_t rows, uint8_t cols, uint8_t flip);
+
 //Function to initialize renderer
 //Takes in color pallette in the format laid out above at colors[4]
 //Sets color pallette to match input
 //Inits SPI
-//Inits ST7789
+//Starts ST7789 bring-up, which is finished by PW8MonoInitStep
 //Returns status
 RenderStatus PW8MonoInit(uint8_t* game_colors){
 	
@@ -27,56 +70,853 @@ RenderStatus PW8MonoInit(uint8_t* game_colors){
 	//Placeholder status
 	RenderStatus status = RENDER_UNKNOWN_ERROR;
 	
-	//Attempt to init SPI, must be before ST7789 init
-	//If error, return error
-	if((status = Spi1TxInit()) != RENDER_OK){
-		return RENDER_DOWNSTREAM_ERROR | status;
+	//Attempt to init SPI, must be before ST7789 init
+	//If error, return error
+	if((status = Spi1TxInit()) != RENDER_OK){
+		return RENDER_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Attempt to start ST7789 init, must be after SPI init
+	//If error, return error
+	if((status = St7789InitStart()) != RENDER_OK){
+		return RENDER_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to advance renderer initialization
+//Takes in a pointer to the ready "boolean"
+//Steps ST7789 bring-up without blocking
+//Sets ready to 1 once the screen can be drawn to
+//Returns status
+RenderStatus PW8MonoInitStep(uint8_t* ready){
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Attempt to step ST7789 init, if error return error
+	if((status = St7789InitStep(ready)) != RENDER_OK){
+		return RENDER_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to map a true pixel x onto frame memory
+//Takes in the on-screen x
+//Rows inside the scroll region are shifted by the scroll offset and wrapped
+//Rows outside it are returned as-is
+uint8_t PW8MonoScrollRow(uint8_t x){
+	
+	//Outside the region or scrolling off, no change
+	if(scroll_lines == 0 || x < scroll_top || x >= scroll_top + scroll_lines){
+		return x;
+	}
+	
+	//Shift by offset and wrap within the region
+	//Compared before adding, a full-screen region would overflow uint8_t
+	uint8_t row = x - scroll_top;
+	
+	if(row >= scroll_lines - scroll_offset){
+		row -= scroll_lines - scroll_offset;
+	} else {
+		row += scroll_offset;
+	}
+	
+	return scroll_top + row;
+}
+
+//Function to expand 1-bit art straight into the SPI stream
+//Takes in the true pixel corner, the art, its size in logical rows and columns, and SPRITE_FLIP_X/Y bits
+//Bit i of the art, MSB first, is logical row i / cols, column i % cols
+//Flips read rows or columns from the far end, so mirrored art costs nothing extra
+//Each bit becomes a PIXEL_SIZE square of ON or OFF color, sent as the FIFO takes it
+//Same-colored neighbors in a row go out as one run
+//Opens a window at the first row, then again only where the scroll region breaks the rows apart
+//Returns status
+RenderStatus PW8MonoExpandBits(uint8_t x, uint8_t y, const uint8_t* art, uint8_t rows, uint8_t cols, uint8_t flip){
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Last true column and the window's last row
+	uint8_t y_end = y + cols * PIXEL_SIZE - 1;
+	uint16_t last = 0;
+	
+	OVERDRAW_RECORD(x, x + rows * PIXEL_SIZE - 1, y, y_end, 2, OVERDRAW_ART);
+	
+	//Mapped row of this logical row and where the next should land
+	uint8_t row = 0;
+	uint8_t next = 0;
+	
+	//Initialize some variables to walk the art
+	uint8_t bit = 0;
+	uint8_t run_bit = 0;
+	uint8_t run = 0;
+	uint8_t dex = 0;
+	
+	for(uint8_t i = 0; i < rows; i++){
+		
+		//Map through the scroll region
+		row = PW8MonoScrollRow(x + i * PIXEL_SIZE);
+		
+		//Open a window for the rest of the art, if error return error
+		if(i == 0 || row != next){
+			last = row + (uint16_t) (rows - i) * PIXEL_SIZE - 1;
+			
+			if(last > SCREEN_LAST){
+				last = SCREEN_LAST;
+			}
+			
+			if((status = St7789Window(row, last, y, y_end)) != RENDER_OK){
+				return RENDER_DOWNSTREAM_ERROR | status;
+			}
+		}
+		
+		next = row + PIXEL_SIZE;
+		
+		//Send the logical row once per true row
+		for(uint8_t k = 0; k < PIXEL_SIZE; k++){
+			
+			run = 0;
+			
+			//First bit of the source row, the last when flipped along y
+			dex = ((flip & SPRITE_FLIP_X) ? rows - 1 - i : i) * cols;
+			
+			if(flip & SPRITE_FLIP_Y){
+				dex += cols - 1;
+			}
+			
+			for(uint8_t j = 0; j < cols; j++){
+				
+				//Select current bit, then step toward the next
+				bit = (art[dex >> 3] >> (7 - (dex & 7))) & 0x01;
+				dex = (flip & SPRITE_FLIP_Y) ? dex - 1 : dex + 1;
+				
+				//Color changed, send the run so far, if error return error
+				if(run && bit != run_bit){
+					if((status = St7789Color(colors[run_bit], colors[run_bit | 0x02], run * PIXEL_SIZE)) != RENDER_OK){
+						return RENDER_DOWNSTREAM_ERROR | status;
+					}
+					
+					run = 0;
+				}
+				
+				run_bit = bit;
+				run++;
+			}
+			
+			//Send the last run, if error return error
+			if((status = St7789Color(colors[run_bit], colors[run_bit | 0x02], run * PIXEL_SIZE)) != RENDER_OK){
+				return RENDER_DOWNSTREAM_ERROR | status;
+			}
+		}
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to fill a window with one color through the scroll region
+//Takes in the on-screen window and the color bit, 0 for OFF, 1 for ON
+//Counts the write for overdraw, then fills with PW8MonoFillMapped
+//Returns status
+RenderStatus PW8MonoFillWindow(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit){
+	
+	OVERDRAW_RECORD(x_start, x_end, y_start, y_end, bit, overdraw_site);
+	
+	//Fill and return status
+	return PW8MonoFillMapped(x_start, x_end, y_start, y_end, bit);
+}
+
+//Function to fill a window with one color through the scroll region, uncounted
+//Takes in the on-screen window and the color bit, 0 for OFF, 1 for ON
+//Maps the window onto frame memory with PW8MonoScrollRow
+//Splits it in two if it wraps around the region's end, then uses St7789Fill
+//Windows that straddle the region's edge are filled unmapped
+//Returns status
+RenderStatus PW8MonoFillMapped(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit){
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Only remap windows that lie wholly in the scroll region
+	if(scroll_lines != 0 && x_start >= scroll_top && x_end < scroll_top + scroll_lines){
+		
+		//Map start, end follows from the window height
+		uint8_t rows = x_end - x_start + 1;
+		x_start = PW8MonoScrollRow(x_start);
+		x_end = x_start + rows - 1;
+		
+		//Check for wrap past the end of the region
+		if(x_end >= scroll_top + scroll_lines){
+			
+			//Rows before the wrap
+			uint8_t first = scroll_top + scroll_lines - x_start;
+			
+			//Fill up to the end of the region, if error return error
+			if((status = St7789Fill(x_start, x_start + first - 1, y_start, y_end, colors[bit], colors[bit | 0x02])) != RENDER_OK){
+				return RENDER_DOWNSTREAM_ERROR | status;
+			}
+			
+			//Continue from the top of the region
+			x_start = scroll_top;
+			x_end = scroll_top + rows - first - 1;
+		}
+	}
+	
+	//Fill, if error return error
+	if((status = St7789Fill(x_start, x_end, y_start, y_end, colors[bit], colors[bit | 0x02])) != RENDER_OK){
+		return RENDER_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to set the hardware scroll region
+//Takes in the first tile column and number of tile columns that scroll
+//The ST7789's vertical scroll runs along panel rows, which are the engine's x axis
+//A count of 0 turns scrolling off
+//Resets the scroll offset to 0
+//Returns status
+RenderStatus PW8MonoSetScrollRegion(uint8_t first_tile, uint8_t tile_count){
+	
+	//Validate region fits on screen
+	if((uint16_t) first_tile + tile_count > TILE_PIXEL_CONV_X + 1){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Convert tiles to true pixels
+	scroll_top = first_tile * TILE_PIXELS;
+	scroll_lines = tile_count * TILE_PIXELS;
+	scroll_offset = 0;
+	
+	//Lines below the visible screen count as bottom fixed area
+	//Attempt to define area, if error return error
+	if((status = St7789ScrollArea(scroll_top, scroll_lines, FRAME_LINES - scroll_top - scroll_lines)) != RENDER_OK){
+		return RENDER_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Attempt to reset start line, if error return error
+	if((status = St7789ScrollStart(scroll_top)) != RENDER_OK){
+		return RENDER_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to move the scroll region by whole tiles without clearing
+//Takes in tiles to scroll, positive moves content toward x = 0
+//Takes in a pointer to the first newly exposed tile column, on-screen
+//Moves the region with a single VSCSAD
+//Exposed columns still hold whatever scrolled off the other end
+//Returns status
+RenderStatus PW8MonoScrollOffset(int8_t tiles, uint8_t* exposed){
+	
+	//Validate scrolling is on
+	if(scroll_lines == 0 || exposed == NULL){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Region size and scroll distance in tiles
+	uint8_t region = scroll_lines / TILE_PIXELS;
+	uint8_t count = (tiles < 0) ? -tiles : tiles;
+	
+	//Scrolling a whole region or more exposes all of it
+	if(count > region){
+		count = region;
+	}
+	
+	//Advance offset, wrapping within the region
+	//Compared before adding, a full-screen region would overflow uint8_t
+	uint8_t shift = (count % region) * TILE_PIXELS;
+	
+	if(tiles >= 0){
+		if(shift >= scroll_lines - scroll_offset){
+			scroll_offset -= scroll_lines - shift;
+		} else {
+			scroll_offset += shift;
+		}
+		
+		//New content enters at the far end
+		*exposed = (scroll_top / TILE_PIXELS) + region - count;
+	} else {
+		if(scroll_offset >= shift){
+			scroll_offset -= shift;
+		} else {
+			scroll_offset += scroll_lines - shift;
+		}
+		
+		//New content enters at the near end
+		*exposed = scroll_top / TILE_PIXELS;
+	}
+	
+	//Content moved under the cells, forget what was known OFF
+	OVERDRAW_FORGET();
+	
+	//Attempt to move the region, if error return error
+	if((status = St7789ScrollStart(scroll_top + scroll_offset)) != RENDER_OK){
+		return RENDER_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to scroll the region by whole tiles
+//Takes in tiles to scroll, positive moves content toward x = 0
+//Takes in a pointer to the first newly exposed tile column, on-screen
+//Moves the region with PW8MonoScrollOffset, then clears only the exposed columns
+//The game draws new content at exposed, sprites keep their on-screen addresses
+//Returns status
+RenderStatus PW8MonoScroll(int8_t tiles, uint8_t* exposed){
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Attempt to move the region, if error return error
+	if((status = PW8MonoScrollOffset(tiles, exposed)) != RENDER_OK){
+		return status;
+	}
+	
+	//Number of exposed columns
+	uint8_t count = (tiles < 0) ? -tiles : tiles;
+	
+	if(count > scroll_lines / TILE_PIXELS){
+		count = scroll_lines / TILE_PIXELS;
+	}
+	
+	//Clear exposed columns one tile at a time so none wraps, if error return error
+	for(uint8_t i = 0; i < count; i++){
+		uint8_t x = (*exposed + i) * TILE_PIXELS;
+		
+		OVERDRAW_SITE(OVERDRAW_COLUMN);
+		
+		if((status = PW8MonoFillWindow(x, x + TILE_PIXELS - 1, 0, SCREEN_LAST, 0)) != RENDER_OK){
+			return status;
+		}
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to draw a run-length compressed image
+//Takes in a pointer to the image, in the format laid out in the header, and its top-left address
+//Decodes straight into the SPI stream with St7789Color, with no image or row buffer
+//Each logical row is replayed from its saved run position for every true row
+//Opens one window for the whole image, or one per true row while scrolling is on
+//Returns status
+RenderStatus PW8MonoDrawImage(const uint8_t* image, uint16_t address){
+	
+	//Validate image
+	if(image == NULL){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Image corner and extent in logical pixels
+	uint8_t x = (address >> 8) & 0x00FF;
+	uint8_t y = address & 0x00FF;
+	uint8_t rows = image[0];
+	uint8_t width = image[1];
+	
+	//Validate image fits on screen
+	if(rows == 0 || width == 0 || (uint16_t) x + rows > LOGICAL_LAST + 1 || (uint16_t) y + width > LOGICAL_LAST + 1){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Convert to true pixels
+	x *= PIXEL_SIZE;
+	y *= PIXEL_SIZE;
+	
+	OVERDRAW_RECORD(x, x + rows * PIXEL_SIZE - 1, y, y + width * PIXEL_SIZE - 1, 2, OVERDRAW_IMAGE);
+	
+	//Without scrolling, one window covers the image
+	if(scroll_lines == 0){
+		if((status = St7789Window(x, x + rows * PIXEL_SIZE - 1, y, y + width * PIXEL_SIZE - 1)) != RENDER_OK){
+			return RENDER_DOWNSTREAM_ERROR | status;
+		}
+	}
+	
+	//Decoder position, current run color and pixels left in it
+	const uint8_t* run = image + IMAGE_HEADER;
+	uint8_t bit = 0;
+	uint8_t left = 0;
+	
+	//Saved position at the start of a logical row
+	const uint8_t* row_run = run;
+	uint8_t row_bit = 0;
+	uint8_t row_left = 0;
+	
+	//Pixels left in the row and this step's share
+	uint8_t remaining = 0;
+	uint8_t n = 0;
+	
+	for(uint8_t i = 0; i < rows; i++){
+		
+		//Save position for replay
+		row_run = run;
+		row_bit = bit;
+		row_left = left;
+		
+		for(uint8_t r = 0; r < PIXEL_SIZE; r++){
+			
+			//Rewind to the start of the row
+			run = row_run;
+			bit = row_bit;
+			left = row_left;
+			
+			//While scrolling, open this true row through the scroll region
+			if(scroll_lines != 0){
+				uint8_t row = PW8MonoScrollRow(x + i * PIXEL_SIZE + r);
+				
+				if((status = St7789Window(row, row, y, y + width * PIXEL_SIZE - 1)) != RENDER_OK){
+					return RENDER_DOWNSTREAM_ERROR | status;
+				}
+			}
+			
+			//Decode runs across the row
+			remaining = width;
+			
+			while(remaining){
+				
+				//Fetch next run
+				if(left == 0){
+					bit = (*run & RLE_COLOR) ? 1 : 0;
+					left = (*run & RLE_LENGTH) + 1;
+					run++;
+				}
+				
+				n = (left < remaining) ? left : remaining;
+				
+				//Stream the run, if error return error
+				if((status = St7789Color(colors[bit], colors[bit | 0x02], (uint16_t) n * PIXEL_SIZE)) != RENDER_OK){
+					return RENDER_DOWNSTREAM_ERROR | status;
+				}
+				
+				left -= n;
+				remaining -= n;
+			}
+		}
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to draw a full column of map tiles
+//Takes in the on-screen tile column and a pointer to packed 4-bit tile art
+//Tiles are packed two per byte, HI first, the same as Sprite art
+//Takes in odd, 1 if the first tile is the LO half of the first byte
+//Opens one window for the whole column and expands art straight into it
+//Returns status
+RenderStatus PW8MonoDrawColumn(uint8_t tile_x, const uint8_t* cells, uint8_t odd){
+	
+	//Validate column on screen
+	if(tile_x > TILE_PIXEL_CONV_X || cells == NULL){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	OVERDRAW_RECORD(tile_x * TILE_PIXELS, tile_x * TILE_PIXELS + TILE_PIXELS - 1, 0, SCREEN_LAST, 2, OVERDRAW_COLUMN);
+	
+	//On-screen rows of the column, mapped through the scroll region
+	//Tile aligned, so the column never wraps
+	uint8_t x = PW8MonoScrollRow(tile_x * TILE_PIXELS);
+	
+	//Open one window for the whole column, if error return error
+	if((status = St7789Window(x, x + TILE_PIXELS - 1, 0, SCREEN_LAST)) != RENDER_OK){
+		return RENDER_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Initialize some variables to walk the art
+	uint8_t cell = 0;
+	uint8_t bit = 0;
+	uint8_t run_bit = 0;
+	uint8_t run = 0;
+	
+	//Iterate through logical rows of the tiles, then true rows of each
+	for(uint8_t row = 0; row < TILE_SIZE; row++){
+		for(uint8_t r = 0; r < PIXEL_SIZE; r++){
+			
+			run = 0;
+			
+			//Walk every tile in the column
+			for(uint8_t t = 0; t <= TILE_PIXEL_CONV_Y; t++){
+				
+				//Select this tile's nibble, HI for even, LO for odd
+				cell = cells[(t + odd) >> 1];
+				cell = ((t + odd) & 0x01) ? (cell & 0x0F) : (cell >> 4);
+				
+				//Gather this row's bits into runs of one color
+				for(uint8_t c = 0; c < TILE_SIZE; c++){
+					bit = (cell >> (3 - (row * TILE_SIZE + c))) & 0x01;
+					
+					//Color changed, send the run so far, if error return error
+					if(run && bit != run_bit){
+						if((status = St7789Color(colors[run_bit], colors[run_bit | 0x02], run * PIXEL_SIZE)) != RENDER_OK){
+							return RENDER_DOWNSTREAM_ERROR | status;
+						}
+						
+						run = 0;
+					}
+					
+					run_bit = bit;
+					run++;
+				}
+			}
+			
+			//Send the last run, if error return error
+			if((status = St7789Color(colors[run_bit], colors[run_bit | 0x02], run * PIXEL_SIZE)) != RENDER_OK){
+				return RENDER_DOWNSTREAM_ERROR | status;
+			}
+		}
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to draw a single monochrome pixel
+//Takes in address of pixel
+//Parses address into x and y, validating for inputs in range
+//Returns RenderStatus
+RenderStatus PW8MonoDrawPixel(uint16_t address){
+	
+	//Parse address into x and y
+	uint8_t x = (address >> 8) & 0x00FF;
+	uint8_t y = address & 0x00FF;
+	
+	//Validate address in range
+	if(x > 239 || y > 239){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Fill the logical pixel's square with the ON color and get status
+	//All OK statuses that I've written or will write are 0
+	//Relatively safe to assume that's true always in this context
+	if((status = PW8MonoFillWindow(x, x + PIXEL_SIZE - 1, y, y + PIXEL_SIZE - 1, 1)) != RENDER_OK){
+		return status;
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to fill a rectangle of logical pixels
+//Takes in the first and last logical x and y, inclusive, and the color bit
+//Color bit is 0 for OFF, 1 for ON
+//One window and a streamed fill, split only where it crosses the scroll region's edges
+//Returns status
+RenderStatus PW8MonoFillRect(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit){
+	
+	//Validate rectangle on screen and not inverted
+	if(x_end > LOGICAL_LAST || y_end > LOGICAL_LAST || x_start > x_end || y_start > y_end){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//True pixel rows and columns of the rectangle
+	uint8_t first = x_start * PIXEL_SIZE;
+	uint8_t last = x_end * PIXEL_SIZE + PIXEL_SIZE - 1;
+	uint8_t col_first = y_start * PIXEL_SIZE;
+	uint8_t col_last = y_end * PIXEL_SIZE + PIXEL_SIZE - 1;
+	
+	//Split at the scroll region's edges so each piece maps cleanly
+	if(scroll_lines != 0){
+		
+		//Part before the region
+		if(first < scroll_top && last >= scroll_top){
+			if((status = PW8MonoFillWindow(first, scroll_top - 1, col_first, col_last, bit & 0x01)) != RENDER_OK){
+				return status;
+			}
+			
+			first = scroll_top;
+		}
+		
+		//Part inside the region, the rest is after it
+		if(first < scroll_top + scroll_lines && last >= scroll_top + scroll_lines){
+			if((status = PW8MonoFillWindow(first, scroll_top + scroll_lines - 1, col_first, col_last, bit & 0x01)) != RENDER_OK){
+				return status;
+			}
+			
+			first = scroll_top + scroll_lines;
+		}
+	}
+	
+	//Fill and return status
+	return PW8MonoFillWindow(first, last, col_first, col_last, bit & 0x01);
+}
+
+//Function to draw the outline of a rectangle of logical pixels
+//Takes in the first and last logical x and y, inclusive, and the color bit
+//Four spans, four windows
+//Returns status
+RenderStatus PW8MonoDrawRect(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit){
+	
+	//Validate rectangle on screen and not inverted
+	if(x_end > LOGICAL_LAST || y_end > LOGICAL_LAST || x_start > x_end || y_start > y_end){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Top and bottom edges, if error return error
+	if((status = PW8MonoDrawHSpan(y_start, x_start, x_end, bit)) != RENDER_OK){
+		return status;
+	}
+	
+	if(y_end != y_start){
+		if((status = PW8MonoDrawHSpan(y_end, x_start, x_end, bit)) != RENDER_OK){
+			return status;
+		}
+	}
+	
+	//Nothing left between the edges
+	if(y_end - y_start < 2){
+		return RENDER_OK;
+	}
+	
+	//Left and right edges without the corners, if error return error
+	if((status = PW8MonoDrawVSpan(x_start, y_start + 1, y_end - 1, bit)) != RENDER_OK){
+		return status;
+	}
+	
+	if(x_end != x_start){
+		if((status = PW8MonoDrawVSpan(x_end, y_start + 1, y_end - 1, bit)) != RENDER_OK){
+			return status;
+		}
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to draw a vertical span of logical pixels
+//Takes in the logical x, the first and last logical y, and the color bit
+//Color bit is 0 for OFF, 1 for ON
+//Costs one window no matter how long the span is
+//Returns status
+RenderStatus PW8MonoDrawVSpan(uint8_t x, uint8_t y_start, uint8_t y_end, uint8_t bit){
+	
+	return PW8MonoFillRect(x, x, y_start, y_end, bit);
+}
+
+//Function to draw a horizontal span of logical pixels
+//Takes in the logical y, the first and last logical x, and the color bit
+//Color bit is 0 for OFF, 1 for ON
+//Costs one window no matter how long the span is, unless it crosses the scroll region's edges
+//Returns status
+RenderStatus PW8MonoDrawHSpan(uint8_t y, uint8_t x_start, uint8_t x_end, uint8_t bit){
+	
+	return PW8MonoFillRect(x_start, x_end, y, y, bit);
+}
+
+//Function to draw a line between two logical pixels
+//Takes in the start and end addresses, (x << 8) | y in logical pixels, and the color bit
+//Bresenham's line, but pixels are gathered into runs along the major axis
+//Each run is sent as one HSpan or VSpan, so shallow and steep lines cost a window per step of the minor axis
+//Axis-aligned lines are a single span
+//Returns status
+RenderStatus PW8MonoDrawLine(uint16_t start, uint16_t end, uint8_t bit){
+	
+	//Parse addresses into x and y
+	int16_t x = (start >> 8) & 0x00FF;
+	int16_t y = start & 0x00FF;
+	int16_t x_last = (end >> 8) & 0x00FF;
+	int16_t y_last = end & 0x00FF;
+	
+	//Validate addresses in range
+	if(x > LOGICAL_LAST || y > LOGICAL_LAST || x_last > LOGICAL_LAST || y_last > LOGICAL_LAST){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Distances and steps
+	int16_t dx = (x_last > x) ? x_last - x : x - x_last;
+	int16_t dy = (y_last > y) ? y_last - y : y - y_last;
+	int8_t sx = (x_last > x) ? 1 : -1;
+	int8_t sy = (y_last > y) ? 1 : -1;
+	int16_t err = dx - dy;
+	int16_t err2 = 0;
+	
+	//Runs go along x for shallow lines, along y for steep ones
+	uint8_t shallow = dx >= dy;
+	
+	//Start of the current run
+	int16_t run_x = x;
+	int16_t run_y = y;
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	while(1){
+		
+		//Stop after the last pixel, the final run is flushed below
+		if(x == x_last && y == y_last){
+			break;
+		}
+		
+		//Step
+		err2 = err << 1;
+		
+		if(err2 > -dy){
+			err -= dy;
+			x += sx;
+		}
+		
+		if(err2 < dx){
+			err += dx;
+			y += sy;
+		}
+		
+		//Flush the run when the minor axis steps, if error return error
+		if(shallow && y != run_y){
+			if((status = PW8MonoDrawHSpan(run_y, (run_x < x - sx) ? run_x : x - sx, (run_x < x - sx) ? x - sx : run_x, bit)) != RENDER_OK){
+				return status;
+			}
+			
+			run_x = x;
+			run_y = y;
+		} else if(!shallow && x != run_x){
+			if((status = PW8MonoDrawVSpan(run_x, (run_y < y - sy) ? run_y : y - sy, (run_y < y - sy) ? y - sy : run_y, bit)) != RENDER_OK){
+				return status;
+			}
+			
+			run_x = x;
+			run_y = y;
+		}
 	}
 	
-	//Attempt to init ST7789, must be after SPI init
-	//If error, return error
-	if((status = St7789Init()) != RENDER_OK){
-		return RENDER_DOWNSTREAM_ERROR | status;
+	//Flush the final run
+	if(shallow){
+		return PW8MonoDrawHSpan(run_y, (run_x < x) ? run_x : x, (run_x < x) ? x : run_x, bit);
 	}
 	
-	//Return OK
-	return RENDER_OK;
+	return PW8MonoDrawVSpan(run_x, (run_y < y) ? run_y : y, (run_y < y) ? y : run_y, bit);
 }
 
-//Function to draw a single monochrome pixel
-//Takes in address of pixel
-//Parses address into x and y, validating for inputs in range
-//Returns RenderStatus
-RenderStatus PW8MonoDrawPixel(uint16_t address){
-	
-	//Parse address into x and y
-	uint8_t x = (address >> 8) & 0x00FF;
-	uint8_t y = address & 0x00FF;
+//Function to draw a batch of logical pixels
+//Takes in arrays of logical pixel addresses and color bits, and the count
+//Addresses are (x << 8) | y in logical pixels, unlike PW8MonoDrawPixel's true pixels
+//Bits may be NULL for all ON
+//Sorts both arrays in place by row, then merges runs of one color into single HSpan windows
+//Where a pixel is listed twice, the later one wins
+//Returns status
+RenderStatus PW8MonoDrawPixels(uint16_t* addresses, uint8_t* bits, uint8_t count){
 	
-	//Validate address in range
-	if(x > 239 || y > 239){
+	//Validate input
+	if(addresses == NULL && count != 0){
 		return RENDER_INVALID_INPUT;
 	}
 	
-	//Art array for writing pixel
-	//A logical "pixel" is a square of PIXEL_SIZE x PIXEL_SIZE
-	// << 1 because 2 bytes per pixel
-	uint8_t turn_on[(PIXEL_SIZE * PIXEL_SIZE) << 1];
-	
-	//Fill array with "on" color
-	for(uint8_t i = 0; i < ((PIXEL_SIZE * PIXEL_SIZE) << 1); i += 2){
-		turn_on[i] = colors[1];
-		turn_on[i + 1] = colors[3];
+	//Validate every address before anything is sorted or sent
+	for(uint8_t i = 0; i < count; i++){
+		if(((addresses[i] >> 8) & 0x00FF) > LOGICAL_LAST || (addresses[i] & 0x00FF) > LOGICAL_LAST){
+			return RENDER_INVALID_INPUT;
+		}
 	}
 	
 	//Placeholder status
 	RenderStatus status = RENDER_UNKNOWN_ERROR;
 	
-	//Send data to driver for drawing and get status
-	//All OK statuses that I've written or will write are 0
-	//Relatively safe to assume that's true always in this context
-	if((status = St7789Draw(x, x + PIXEL_SIZE - 1, y, y + PIXEL_SIZE - 1, turn_on, ((PIXEL_SIZE * PIXEL_SIZE) << 1))) != RENDER_OK){
-		return RENDER_DOWNSTREAM_ERROR | status;
+	//Placeholders for sorting by y then x
+	uint16_t held = 0;
+	uint8_t held_bit = 0;
+	uint16_t key = 0;
+	uint8_t j = 0;
+	
+	//Insertion sort on the byte-swapped address, so rows come out together
+	for(uint8_t i = 1; i < count; i++){
+		
+		held = addresses[i];
+		held_bit = (bits == NULL) ? 1 : bits[i];
+		key = (held << 8) | (held >> 8);
+		j = i;
+		
+		while(j > 0 && (uint16_t) ((addresses[j - 1] << 8) | (addresses[j - 1] >> 8)) > key){
+			addresses[j] = addresses[j - 1];
+			
+			if(bits != NULL){
+				bits[j] = bits[j - 1];
+			}
+			
+			j--;
+		}
+		
+		addresses[j] = held;
+		
+		if(bits != NULL){
+			bits[j] = held_bit;
+		}
+	}
+	
+	//Current run, none open yet
+	uint8_t open = 0;
+	uint8_t y = 0;
+	uint8_t x_start = 0;
+	uint8_t x_end = 0;
+	uint8_t bit = 0;
+	
+	//Placeholders for each pixel
+	uint8_t x = 0;
+	uint8_t this_y = 0;
+	uint8_t this_bit = 0;
+	
+	for(uint8_t i = 0; i < count; i++){
+		
+		//Parse address into x and y
+		x = (addresses[i] >> 8) & 0x00FF;
+		this_y = addresses[i] & 0x00FF;
+		this_bit = (bits == NULL) ? 1 : (bits[i] & 0x01);
+		
+		//Extend the run if this is the next pixel in it, or the same one in the same color
+		if(open && this_y == y && this_bit == bit && (x == x_end + 1 || x == x_end)){
+			x_end = x;
+			continue;
+		}
+		
+		//Otherwise flush the open run, if error return error
+		if(open){
+			if((status = PW8MonoDrawHSpan(y, x_start, x_end, bit)) != RENDER_OK){
+				return status;
+			}
+		}
+		
+		//Start a new run here
+		open = 1;
+		y = this_y;
+		x_start = x;
+		x_end = x;
+		bit = this_bit;
+	}
+	
+	//Flush the last run, if error return error
+	if(open){
+		if((status = PW8MonoDrawHSpan(y, x_start, x_end, bit)) != RENDER_OK){
+			return status;
+		}
 	}
 	
 	//Return OK
@@ -86,14 +926,14 @@ RenderStatus PW8MonoDrawPixel(uint16_t address){
 //Function to draw a tile to the screen
 //Takes in the tile and the artwork for that tile
 //Validates tile size and address
-//Parses monochrome art and converts to 16-bit color
+//Expands monochrome art to 16-bit color as it is sent, with no staging array
 //Returns status
 RenderStatus PW8MonoDrawTile(Tile* tile, uint8_t* art){
 	
 	//Calculate total pixels for validation
 	uint8_t pixel_count = tile->size * tile->size * PIXEL_SQUARE;
 	
-	//Validate pixel count to ensure no more than 128 elements in the output array
+	//Validate pixel count to keep tiles to their largest size
 	if(pixel_count > MAX_PIXELS){
 		return RENDER_INVALID_INPUT;
 	}
@@ -111,59 +951,71 @@ RenderStatus PW8MonoDrawTile(Tile* tile, uint8_t* art){
 		return RENDER_INVALID_INPUT;
 	}
 	
-	//Initialize output array
-	uint8_t two_byte_art[MAX_PIXELS << 1] = {0};
-	
-	//Calculate number of bits from size
-	uint8_t bits = tile->size * tile->size;
-	
-	//Initialize some variables to walk the array
-	uint8_t byte = 0;
-	uint8_t bit = 0;
-	uint8_t hi = 0;
-	uint8_t lo = 0;
-	uint8_t dex = 0;
-	uint8_t col = (PIXEL_SIZE * tile->size) << 1;
-	
-	//Loop through input bits
-	for(uint8_t i = 0; i < bits; i++){
-		
-		//Select current bit
-		byte = art[i >> 3];
-		bit = (byte >> (7 - (i & 7))) & 0x01;
-		
-		//Use bit to get hi and lo bytes of the color
-		hi = colors[bit];
-		lo = colors[bit | 0x02];
-		
-		//Select index of the hi byte of the top-left true pixel of the current logical pixel
-		dex = ((i / tile->size) * tile->size * PIXEL_SQUARE * 2) + ((i % tile->size) * PIXEL_SIZE * 2);
-		
-		//Iterate through columns
-		for(uint8_t j = 0; j < PIXEL_SIZE; j++){
-			
-			//Iterate through rows
-			for(uint8_t k = 0; k < (PIXEL_SIZE << 1); k += 2){
-				//Write hi and lo bytes of the color to the output array
-				two_byte_art[dex + k] = hi;
-				two_byte_art[dex + k + 1] = lo;
-			}
-			
-			//Increment index to next column
-			dex += col;
-		}
-	}
-	
 	//Placeholder status
 	RenderStatus status = RENDER_UNKNOWN_ERROR;
 	
-	//Send output array to screen and return status if error
+	//Expand art straight to the screen and return status if error
 	//Assumes that, since I wrote all of these, all OK status codes are 0
 	//They are all 0
-	if((status = St7789Draw(x, x + tile->size * PIXEL_SIZE - 1, y, y + tile->size * PIXEL_SIZE - 1, two_byte_art, pixel_count << 1)) != RENDER_OK){
-		return RENDER_DOWNSTREAM_ERROR | status;
+	if((status = PW8MonoExpandBits(x, y, art, tile->size, tile->size, 0)) != RENDER_OK){
+		return status;
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to clip a Sprite against the clip rectangle
+//Takes in the Sprite and pointers to the visible tile range, relative to the Sprite
+//Address bytes 128-255 are treated as negative, so Sprites can hang off the top or left
+//Never changes the Sprite
+//Returns 1 if any tile is visible, 0 if the Sprite is culled
+uint8_t PW8MonoClipSprite(Sprite* sprite, uint8_t* i_start, uint8_t* i_end, uint8_t* j_start, uint8_t* j_end){
+	
+	//Parse size from Sprite, 2-5 tiles
+	int16_t width = ((sprite->sprite_flags >> 4) & 0x03) + 2;
+	int16_t height = ((sprite->sprite_flags >> 6) & 0x03) + 2;
+	
+	//Parse signed address from Sprite
+	int16_t x = (int8_t) ((sprite->address >> 8) & 0x00FF);
+	int16_t y = (int8_t) (sprite->address & 0x00FF);
+	
+	//Visible range in screen tiles
+	int16_t x_first = (x > clip_x_start) ? x : clip_x_start;
+	int16_t x_last = (x + width - 1 < clip_x_end) ? x + width - 1 : clip_x_end;
+	int16_t y_first = (y > clip_y_start) ? y : clip_y_start;
+	int16_t y_last = (y + height - 1 < clip_y_end) ? y + height - 1 : clip_y_end;
+	
+	//Cull if nothing is left
+	if(x_first > x_last || y_first > y_last){
+		return 0;
+	}
+	
+	//Convert to Sprite-relative tiles
+	*i_start = x_first - x;
+	*i_end = x_last - x;
+	*j_start = y_first - y;
+	*j_end = y_last - y;
+	
+	return 1;
+}
+
+//Function to set the clip rectangle
+//Takes in the first and last visible tile on each axis, inclusive
+//Sprites are only drawn and cleared inside it, so HUD or split-screen regions stay intact
+//Returns status
+RenderStatus PW8MonoSetClip(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end){
+	
+	//Validate rectangle on screen and not inverted
+	if(x_end > TILE_PIXEL_CONV_X || y_end > TILE_PIXEL_CONV_Y || x_start > x_end || y_start > y_end){
+		return RENDER_INVALID_INPUT;
 	}
 	
+	clip_x_start = x_start;
+	clip_x_end = x_end;
+	clip_y_start = y_start;
+	clip_y_end = y_end;
+	
 	//Return OK
 	return RENDER_OK;
 }
@@ -172,117 +1024,61 @@ RenderStatus PW8MonoDrawTile(Tile* tile, uint8_t* art){
 //Takes in the Sprite
 //Parses the Sprite data for address and artwork
 //Fetches artwork from game files
-//Draws artwork to the correct address on the screen using DrawTile
-//DOES NOT handle wrapping
-//DOES change Sprite address to valid bounds
+//Draws only the tiles inside the clip rectangle, expanding each straight to the screen
+//Sprites wholly outside it cost nothing
+//SPRITE_FLIP_X/Y in the animation byte mirror the tile order and each tile's bits
+//DOES NOT handle wrapping or change the Sprite
 //Returns status
 RenderStatus PW8MonoDrawSprite(Sprite* sprite){
 	
-	//Parse art and size from Sprite
-	uint8_t* art = GetSpriteArt(sprite->animation, sprite->sprite_flags);
-	uint8_t height = (sprite->sprite_flags >> 6) & 0x03;
-	uint8_t width = (sprite->sprite_flags >> 4) & 0x03;
+	//Visible tile range, relative to the Sprite
+	uint8_t i_start = 0;
+	uint8_t i_end = 0;
+	uint8_t j_start = 0;
+	uint8_t j_end = 0;
+	
+	//Cull if off screen
+	if(!PW8MonoClipSprite(sprite, &i_start, &i_end, &j_start, &j_end)){
+		return RENDER_OK;
+	}
+	
+	//Visible, so the next SPI byte touches this Sprite
+	LATENCY_DRAW(sprite);
 	
-	//Create Tile to draw
-	Tile this_tile;
-	this_tile.size = TILE_SIZE;
+	//Parse art, size and flips from Sprite
+	uint8_t* art = GetSpriteArt(sprite->animation & ANIMATION_MASK, sprite->sprite_flags);
+	uint8_t width = ((sprite->sprite_flags >> 4) & 0x03) + 2;
+	uint8_t height = ((sprite->sprite_flags >> 6) & 0x03) + 2;
+	uint8_t flip = sprite->animation & (SPRITE_FLIP_X | SPRITE_FLIP_Y);
+	
+	//Parse address from Sprite data
+	uint8_t x = (sprite->address >> 8) & 0x00FF;
+	uint8_t y = sprite->address & 0x00FF;
 	
 	//Placeholder for each Tile's artwork
 	uint8_t this_art = 0;
 	
-	//Half-byte index for HI or LO
-	//0 = HI, 1 = LO
-	uint8_t half = 0;
-	
-	//Index counter
+	//Nibble index of the Tile's art, two Tiles per byte, HI first
 	uint8_t dex = 0;
 	
 	//Return status to check for errors
 	//Initialized to an error code in case it never changes
 	RenderStatus status = RENDER_UNKNOWN_ERROR;
 	
-	//Parse address from Sprite data
-	uint8_t x = (sprite->address >> 8) & 0x00FF;
-	uint8_t y = sprite->address & 0x00FF;
-	
-	//Store initial Y address to allow top-to-bottom, left-to-right drawing
-	uint8_t y_i = y;
-	
-	//Nested For loop to iterate through Tiles covered by Sprite
-	for(uint8_t i = 0; i < width + 2; i++){
-		
-		//Validate x underflow
-		if(x > 254){
-			
-			//If x underflows from 0, reset to 0
-			x = 0;
-			sprite->address &= 0x00FF;
-			i--;
-			continue;
-		}
-		
-		//Validate x overflow
-		if(x > TILE_PIXEL_CONV_X){
-			
-			//If x overflows max address, reset to max
-			x = TILE_PIXEL_CONV_X;
-			sprite->address &= 0x00FF;
-			sprite->address |= (x >> 8);
-			i--;
-			continue;
-		}
-		
-		for(uint8_t j = 0; j < height + 2; j++){
-			
-			if(y > 254){
-				y = 0;
-				sprite->address &= 0xFF00;
-				j--;
-				continue;
-			}
-			
-			//Validate y in range
-			if(y > TILE_PIXEL_CONV_Y){
-				
-				//If y out of range, start over at 0
-				y = TILE_PIXEL_CONV_Y;
-				sprite->address &= 0xFF00;
-				sprite->address |= y;
-				j--;
-				continue;
-			}
+	//Nested For loop to iterate through visible Tiles, left to right, top to bottom
+	for(uint8_t i = i_start; i <= i_end; i++){
+		for(uint8_t j = j_start; j <= j_end; j++){
 			
-			//Reassemble address
-			this_tile.address = ((x & 0x00FF) << 8) | (y & 0x00FF);
+			//Get HI or LO half of art byte, from the mirrored Tile if flipped
+			dex = ((flip & SPRITE_FLIP_X) ? width - 1 - i : i) * height + ((flip & SPRITE_FLIP_Y) ? height - 1 - j : j);
+			this_art = (dex & 0x01) ? ((art[dex >> 1] & 0x0F) << 4) : (art[dex >> 1] & 0xF0);
 			
-			//Switch to get HI or LO half of art byte
+			//Draw Tile at its true pixel corner, wraps back to on-screen for negative addresses
 			//Return error if error
-			switch(half){
-				case 0:
-					this_art = (art[dex] & 0xF0);
-					half = 1;
-					break;
-				case 1:
-					this_art = (art[dex] & 0x0F) << 4;
-					half = 0;
-					dex++;
-					break;
-				default:
-					return RENDER_UNKNOWN_ERROR;
-			}
-			
-			//Draw Tile, return error if error
-			if((status = PW8MonoDrawTile(&this_tile, &this_art)) != RENDER_OK){
+			if((status = PW8MonoExpandBits(((x + i) & 0x00FF) * TILE_PIXELS, ((y + j) & 0x00FF) * TILE_PIXELS, &this_art, TILE_SIZE, TILE_SIZE, flip)) != RENDER_OK){
 				return status;
 			}
-			
-			y++;
 		}
-		
-		x++;
-		
-		//Wrap back to top Y
-		y = y_i;
 	}
 	
 	//Return OK
@@ -291,119 +1087,39 @@ RenderStatus PW8MonoDrawSprite(Sprite* sprite){
 
 //Function to clear a Sprite's animation
 //Takes in the Sprite
-//Writes the OFF color to each pixel
-//Like DrawSprite, this WILL overwrite Sprite address to keep it in bounds
+//Fills the visible part of the Sprite with the OFF color in a single window
+//Like DrawSprite, this clips and never changes the Sprite
 //Returns status
 RenderStatus PW8MonoClearSprite(Sprite* sprite){
-	//Parse art and size from Sprite
-	uint8_t art[2] = {colors[0], colors[2]};
-	uint8_t height = (sprite->sprite_flags >> 6) & 0x03;
-	uint8_t width = (sprite->sprite_flags >> 4) & 0x03;
-	
-	//Create Tile to draw
-	Tile this_tile;
-	this_tile.size = TILE_SIZE;
 	
-	//Placeholder for each Tile's artwork
-	uint8_t this_art = 0;
+	//Visible tile range, relative to the Sprite
+	uint8_t i_start = 0;
+	uint8_t i_end = 0;
+	uint8_t j_start = 0;
+	uint8_t j_end = 0;
 	
-	//Half-byte index for HI or LO
-	//0 = HI, 1 = LO
-	uint8_t half = 0;
-	
-	//Index counter
-	uint8_t dex = 0;
+	//Cull if off screen
+	if(!PW8MonoClipSprite(sprite, &i_start, &i_end, &j_start, &j_end)){
+		return RENDER_OK;
+	}
 	
-	//Return status to check for errors
-	//Initialized to an error code in case it never changes
-	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	//Visible, so the next SPI byte touches this Sprite
+	LATENCY_DRAW(sprite);
 	
 	//Parse address from Sprite data
 	uint8_t x = (sprite->address >> 8) & 0x00FF;
 	uint8_t y = sprite->address & 0x00FF;
 	
-	//Store initial Y address to allow top-to-bottom, left-to-right drawing
-	uint8_t y_i = y;
+	//Convert visible tiles to true pixels
+	uint8_t x_start = (uint8_t) (x + i_start) * TILE_PIXELS;
+	uint8_t x_end = (uint8_t) (x + i_end) * TILE_PIXELS + TILE_PIXELS - 1;
+	uint8_t y_start = (uint8_t) (y + j_start) * TILE_PIXELS;
+	uint8_t y_end = (uint8_t) (y + j_end) * TILE_PIXELS + TILE_PIXELS - 1;
 	
-	//Nested For loop to iterate through Tiles covered by Sprite
-	for(uint8_t i = 0; i < width + 2; i++){
-		
-		//Validate x underflow
-		if(x > 254){
-			
-			//If x underflows from 0, reset to 0
-			x = 0;
-			sprite->address &= 0x00FF;
-			i--;
-			continue;
-		}
-		
-		//Validate x overflow
-		if(x > TILE_PIXEL_CONV_X){
-			
-			//If x overflows max address, reset to max
-			x = TILE_PIXEL_CONV_X;
-			sprite->address &= 0x00FF;
-			sprite->address |= (x >> 8);
-			i--;
-			continue;
-		}
-		
-		for(uint8_t j = 0; j < height + 2; j++){
-			
-			if(y > 254){
-				y = 0;
-				sprite->address &= 0xFF00;
-				j--;
-				continue;
-			}
-			
-			//Validate y in range
-			if(y > TILE_PIXEL_CONV_Y){
-				
-				//If y out of range, start over at 0
-				y = TILE_PIXEL_CONV_Y;
-				sprite->address &= 0xFF00;
-				sprite->address |= y;
-				j--;
-				continue;
-			}
-			
-			//Reassemble address
-			this_tile.address = ((x & 0x00FF) << 8) | (y & 0x00FF);
-			
-			//Switch to get HI or LO half of art byte
-			//Return error if error
-			switch(half){
-				case 0:
-					this_art = (art[dex & 0x01] & 0xF0);
-					half = 1;
-					break;
-				case 1:
-					this_art = (art[dex & 0x01] & 0x0F) << 4;
-					half = 0;
-					dex++;
-					break;
-				default:
-					return RENDER_UNKNOWN_ERROR;
-			}
-			
-			//Draw Tile, return error if error
-			if((status = PW8MonoDrawTile(&this_tile, &this_art)) != RENDER_OK){
-				return status;
-			}
-			
-			y++;
-		}
-		
-		x++;
-		
-		//Wrap back to top Y
-		y = y_i;
-	}
+	OVERDRAW_SITE(OVERDRAW_CLEAR_SPRITE);
 	
-	//Return OK
-	return RENDER_OK;
+	//Fill and return status
+	return PW8MonoFillWindow(x_start, x_end, y_start, y_end, 0);
 }
 
 //Function to write a character to the screen
@@ -514,28 +1230,52 @@ RenderStatus PW8MonoEraseChar(uint16_t address){
 	uint8_t x_end = x_start + (5 * PIXEL_SIZE) - 1;
 	uint8_t y_end = y_start + (5 * PIXEL_SIZE) - 1;
 	
-	//Create array to hold clear artwork
-	uint8_t art[CHAR_ARRAY_SIZE];
-	
 	//Placeholder status
 	RenderStatus status = RENDER_UNKNOWN_ERROR;
 	
-	//Populate clear artwork with OFF color
-	for(uint8_t i = 0; i < CHAR_ARRAY_SIZE; i += 2){
-		art[i] = colors[0];
-		art[i + 1] = colors[2];
-	}
+	OVERDRAW_SITE(OVERDRAW_ERASE_CHAR);
 	
-	//Attempt to draw OFF color to all the pixels in the char
+	//Attempt to fill all the pixels in the char with OFF color
 	//If error, return error
-	if((status = St7789Draw(x_start, x_end, y_start, y_end, art, CHAR_ARRAY_SIZE)) != RENDER_OK){
-		return RENDER_DOWNSTREAM_ERROR | status;
+	if((status = PW8MonoFillWindow(x_start, x_end, y_start, y_end, 0)) != RENDER_OK){
+		return status;
 	}
 	
 	//Return OK
 	return RENDER_OK;
 }
 
+//Function to draw a character and its background in one window
+//Takes in the character and the top-left logical pixel address
+//Expands the 5x5 font art to ON and OFF colors, so nothing needs erasing first
+//Costs one window instead of a DrawPixel per lit pixel
+//Returns status
+RenderStatus PW8MonoBlitChar(uint8_t character, uint16_t address){
+	
+	//Parse address into logical x and y
+	uint8_t x_start = (address >> 8) & 0x00FF;
+	uint8_t y_start = address & 0x00FF;
+	
+	//Validate the whole character is on screen, before scaling can wrap
+	if(x_start > LOGICAL_LAST - 4 || y_start > LOGICAL_LAST - 4){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	//Convert to true pixels
+	x_start *= PIXEL_SIZE;
+	y_start *= PIXEL_SIZE;
+	
+	//Fetch correct artwork
+	const uint8_t* char_art = GetFont(character);
+	
+	//Font bits run 5 along y, then step x, see WriteChar
+	//The font holds 24 bits, so pad a copy for the 25th cell, always OFF
+	uint8_t glyph[4] = {char_art[0], char_art[1], char_art[2], 0};
+	
+	//Expand, draw and return status
+	return PW8MonoExpandBits(x_start, y_start, glyph, 5, 5, 0);
+}
+
 //Function to erase a string written to the screen
 //Takes in the top-left logical pixel address and the length
 //Calls EraseChar until the whole string is erased
@@ -581,6 +1321,9 @@ RenderStatus PW8MonoClearScreen(void){
 	//Placeholder status
 	RenderStatus status = RENDER_UNKNOWN_ERROR;
 	
+	//Black only counts as OFF when OFF is black
+	OVERDRAW_RECORD(0, SCREEN_LAST, 0, SCREEN_LAST, (colors[0] | colors[2]) ? 2 : 0, OVERDRAW_CLEAR_SCREEN);
+	
 	//Attempt to clear the screen
 	//If error, return error
 	if((status = St7789Clear()) != RENDER_OK){
@@ -590,3 +1333,155 @@ RenderStatus PW8MonoClearScreen(void){
 	//Return OK
 	return RENDER_OK;
 }
+
+#ifdef PW_OVERDRAW
+//Function to count a window's writes
+//Takes in the on-screen window in true pixels, the color bit, 2 for mixed art, and the call site
+//Adds to the heat of every cell it touches and to the site's totals
+//OFF onto a cell known OFF is redundant, OFF over a whole cell makes it known
+//Anything else makes the cells it touches unknown
+void PW8MonoOverdrawRecord(uint8_t x_start, uint8_t x_end, uint8_t y_start, uint8_t y_end, uint8_t bit, uint8_t site){
+	
+	//Overlap with the current cell
+	uint8_t x0 = 0;
+	uint8_t x1 = 0;
+	uint8_t y0 = 0;
+	uint8_t y1 = 0;
+	uint16_t pixels = 0;
+	uint8_t mask = 0;
+	
+	for(uint8_t cx = x_start / OVERDRAW_CELL; cx <= x_end / OVERDRAW_CELL; cx++){
+		
+		//Clamp rows to this cell
+		x0 = (x_start > cx * OVERDRAW_CELL) ? x_start : cx * OVERDRAW_CELL;
+		x1 = (x_end < cx * OVERDRAW_CELL + OVERDRAW_CELL - 1) ? x_end : cx * OVERDRAW_CELL + OVERDRAW_CELL - 1;
+		
+		for(uint8_t cy = y_start / OVERDRAW_CELL; cy <= y_end / OVERDRAW_CELL; cy++){
+			
+			//Clamp columns to this cell
+			y0 = (y_start > cy * OVERDRAW_CELL) ? y_start : cy * OVERDRAW_CELL;
+			y1 = (y_end < cy * OVERDRAW_CELL + OVERDRAW_CELL - 1) ? y_end : cy * OVERDRAW_CELL + OVERDRAW_CELL - 1;
+			
+			pixels = (uint16_t) (x1 - x0 + 1) * (y1 - y0 + 1);
+			mask = 0x80 >> cy;
+			
+			//Heat saturates rather than wrapping
+			overdraw_heat[cx][cy] = (overdraw_heat[cx][cy] > 0xFFFF - pixels) ? 0xFFFF : overdraw_heat[cx][cy] + pixels;
+			overdraw_sites[site].writes += pixels;
+			
+			if(bit == 0){
+				if(overdraw_blank[cx] & mask){
+					overdraw_sites[site].redundant += pixels;
+				} else if(pixels == OVERDRAW_CELL * OVERDRAW_CELL){
+					overdraw_blank[cx] |= mask;
+				}
+			} else {
+				overdraw_blank[cx] &= ~mask;
+			}
+		}
+	}
+	
+	//Fills default back to plain
+	overdraw_site = OVERDRAW_FILL;
+}
+
+//Function to reset overdraw counts
+//Takes no inputs
+//Zeroes heat and site totals and forgets which cells are OFF
+//Returns OK
+RenderStatus PW8MonoOverdrawReset(void){
+	
+	for(uint8_t i = 0; i < OVERDRAW_GRID; i++){
+		for(uint8_t j = 0; j < OVERDRAW_GRID; j++){
+			overdraw_heat[i][j] = 0;
+		}
+		
+		overdraw_blank[i] = 0;
+	}
+	
+	for(uint8_t i = 0; i < OVERDRAW_SITES; i++){
+		overdraw_sites[i].writes = 0;
+		overdraw_sites[i].redundant = 0;
+	}
+	
+	overdraw_site = OVERDRAW_FILL;
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to get overdraw totals per call site
+//Takes a pointer to be set to the OVERDRAW_SITES totals, indexed by OVERDRAW_FILL and friends
+//Returns status
+RenderStatus PW8MonoOverdrawSites(const OverdrawSite** sites){
+	
+	//Validate input
+	if(sites == NULL){
+		return RENDER_INVALID_INPUT;
+	}
+	
+	*sites = overdraw_sites;
+	
+	//Return OK
+	return RENDER_OK;
+}
+
+//Function to draw the overdraw heatmap
+//Takes no inputs
+//Clears the screen, then draws each cell as an ON square sized by its heat against the hottest
+//Any written cell shows at least a PIXEL_SIZE square, unwritten cells stay OFF
+//Squares go through PW8MonoFillMapped, so they land where the cells show under scrolling and aren't counted
+//Returns status
+RenderStatus PW8MonoOverdrawShow(void){
+	
+	//Placeholder status
+	RenderStatus status = RENDER_UNKNOWN_ERROR;
+	
+	//Find the hottest cell
+	uint16_t hottest = 0;
+	
+	for(uint8_t i = 0; i < OVERDRAW_GRID; i++){
+		for(uint8_t j = 0; j < OVERDRAW_GRID; j++){
+			if(overdraw_heat[i][j] > hottest){
+				hottest = overdraw_heat[i][j];
+			}
+		}
+	}
+	
+	//Clear to OFF, if error return error
+	if((status = St7789Fill(0, SCREEN_LAST, 0, SCREEN_LAST, colors[0], colors[2])) != RENDER_OK){
+		return RENDER_DOWNSTREAM_ERROR | status;
+	}
+	
+	//Side of the square and its inset from the cell's corner
+	uint8_t side = 0;
+	uint8_t inset = 0;
+	
+	for(uint8_t i = 0; i < OVERDRAW_GRID; i++){
+		for(uint8_t j = 0; j < OVERDRAW_GRID; j++){
+			
+			if(overdraw_heat[i][j] == 0){
+				continue;
+			}
+			
+			//Scale to the cell, keep it even and visible
+			side = ((uint32_t) overdraw_heat[i][j] * OVERDRAW_CELL) / hottest;
+			side &= ~0x01;
+			
+			if(side < PIXEL_SIZE){
+				side = PIXEL_SIZE;
+			}
+			
+			inset = (OVERDRAW_CELL - side) >> 1;
+			
+			//Draw the square, if error return error
+			if((status = PW8MonoFillMapped(i * OVERDRAW_CELL + inset, i * OVERDRAW_CELL + inset + side - 1, j * OVERDRAW_CELL + inset, j * OVERDRAW_CELL + inset + side - 1, 1)) != RENDER_OK){
+				return RENDER_DOWNSTREAM_ERROR | status;
+			}
+		}
+	}
+	
+	//Return OK
+	return RENDER_OK;
+}
+#endif
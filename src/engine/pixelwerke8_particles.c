@@ -0,0 +1,232 @@
+#include <stddef.h>
+#include "pixelwerke8_particles.h"
+
+//Pool of particles, owned by the game
+//Live particles are packed at the front, sorted by x then y after each update
+//That way each frame's output is already batched
+static Particle* particles = NULL;
+static uint8_t particle_count = 0;
+
+//Number of live particles, and how many of those are on screen
+static uint8_t live_count = 0;
+static uint8_t drawn_count = 0;
+
+uint16_t PWParticleKey(Particle* particle);
+ParticleStatus PWParticlesRender(uint8_t count, uint8_t bit);
+void PWParticlesSort(void);
+
+//Function to get a particle's sort key
+//Takes in the particle
+//Returns x in [15..8] and y in [7..0], or PARTICLE_FREE_KEY if free
+uint16_t PWParticleKey(Particle* particle){
+	
+	if(particle->life == 0){
+		return PARTICLE_FREE_KEY;
+	}
+	
+	return ((uint16_t) particle->x << 8) | particle->y;
+}
+
+//Function to render the front of the pool in one color
+//Takes in how many particles to render and the color bit, 0 for OFF, 1 for ON
+//Walks the sorted pool, merging neighbours along y into one VSpan
+//Returns status
+ParticleStatus PWParticlesRender(uint8_t count, uint8_t bit){
+	
+	//Placeholder status
+	ParticleStatus status = PARTICLE_UNKNOWN_ERROR;
+	
+	//Current span, none open yet
+	uint8_t open = 0;
+	uint8_t x = 0;
+	uint8_t y_start = 0;
+	uint8_t y_end = 0;
+	
+	for(uint8_t i = 0; i < count; i++){
+		
+		//Extend the span if this is the same or the next pixel along y
+		if(open && particles[i].x == x && particles[i].y <= y_end + 1){
+			y_end = particles[i].y;
+			continue;
+		}
+		
+		//Otherwise flush the open span, if error return error
+		if(open){
+			if((status = PW8MonoDrawVSpan(x, y_start, y_end, bit)) != PARTICLE_OK){
+				return PARTICLE_DOWNSTREAM_ERROR | status;
+			}
+		}
+		
+		//Start a new span here
+		open = 1;
+		x = particles[i].x;
+		y_start = particles[i].y;
+		y_end = particles[i].y;
+	}
+	
+	//Flush the last span, if error return error
+	if(open){
+		if((status = PW8MonoDrawVSpan(x, y_start, y_end, bit)) != PARTICLE_OK){
+			return PARTICLE_DOWNSTREAM_ERROR | status;
+		}
+	}
+	
+	//Return OK
+	return PARTICLE_OK;
+}
+
+//Function to sort the live particles by key
+//Insertion sort, since particles barely move between frames the pool is nearly sorted
+//That makes it close to one pass in practice
+//Particles that died sink to the end and live_count is trimmed to match
+void PWParticlesSort(void){
+	
+	//Placeholders for the particle being placed
+	Particle held;
+	uint16_t key = 0;
+	uint8_t j = 0;
+	
+	for(uint8_t i = 1; i < live_count; i++){
+		
+		held = particles[i];
+		key = PWParticleKey(&held);
+		j = i;
+		
+		//Shift larger keys up
+		while(j > 0 && PWParticleKey(&particles[j - 1]) > key){
+			particles[j] = particles[j - 1];
+			j--;
+		}
+		
+		particles[j] = held;
+	}
+	
+	//Trim the dead off the end
+	while(live_count > 0 && particles[live_count - 1].life == 0){
+		live_count--;
+	}
+}
+
+//Function to initialize the particle pool
+//Takes in the game's particle array and its length
+//Frees every particle
+//Returns status
+ParticleStatus PWParticlesInit(Particle* pool, uint8_t count){
+	
+	//Validate input
+	if(pool == NULL && count != 0){
+		return PARTICLE_INVALID_INPUT;
+	}
+	
+	particles = pool;
+	particle_count = count;
+	live_count = 0;
+	drawn_count = 0;
+	
+	//Free every particle
+	for(uint8_t i = 0; i < count; i++){
+		particles[i].life = 0;
+	}
+	
+	//Return OK
+	return PARTICLE_OK;
+}
+
+//Function to spawn a particle
+//Takes in the logical pixel address, velocity and life as laid out in Particle
+//Appends to the live particles, the next update sorts it into place
+//Returns status
+ParticleStatus PWParticleSpawn(uint8_t x, uint8_t y, uint8_t velocity, uint8_t life){
+	
+	//Validate input
+	if(x > LOGICAL_LAST || y > LOGICAL_LAST || life == 0){
+		return PARTICLE_INVALID_INPUT;
+	}
+	
+	//Fail if the pool is full
+	if(live_count >= particle_count){
+		return PARTICLE_POOL_FULL;
+	}
+	
+	//Fill the first free slot
+	particles[live_count].x = x;
+	particles[live_count].y = y;
+	particles[live_count].velocity = velocity;
+	particles[live_count].life = life;
+	live_count++;
+	
+	//Return OK
+	return PARTICLE_OK;
+}
+
+//Function to update and redraw all particles
+//No inputs
+//Erases last frame's pixels as spans, steps and ages every particle in one loop,
+//re-sorts, then draws the new pixels as spans
+//Particles that leave the screen or run out of life are freed
+//Returns status
+ParticleStatus PWParticlesUpdate(void){
+	
+	//Placeholder status
+	ParticleStatus status = PARTICLE_UNKNOWN_ERROR;
+	
+	//Erase old pixels while the pool is still in last frame's order, if error return error
+	//New spawns past drawn_count were never drawn, so they aren't erased
+	if((status = PWParticlesRender(drawn_count, 0)) != PARTICLE_OK){
+		return status;
+	}
+	
+	//Step placeholders
+	int8_t dx = 0;
+	int8_t dy = 0;
+	
+	//Step and age every live particle
+	for(uint8_t i = 0; i < live_count; i++){
+		
+		particles[i].life--;
+		
+		//Sign-extend the velocity nibbles
+		dx = (int8_t) (particles[i].velocity & 0xF0) >> 4;
+		dy = (int8_t) (particles[i].velocity << 4) >> 4;
+		
+		particles[i].x += dx;
+		particles[i].y += dy;
+		
+		//Free if off screen, unsigned wrap covers both edges
+		if(particles[i].x > LOGICAL_LAST || particles[i].y > LOGICAL_LAST){
+			particles[i].life = 0;
+		}
+	}
+	
+	//Restore order and drop the dead
+	PWParticlesSort();
+	
+	//Draw new pixels and return status
+	drawn_count = live_count;
+	return PWParticlesRender(drawn_count, 1);
+}
+
+//Function to erase and free all particles
+//No inputs
+//Returns status
+ParticleStatus PWParticlesClear(void){
+	
+	//Placeholder status
+	ParticleStatus status = PARTICLE_UNKNOWN_ERROR;
+	
+	//Erase, if error return error
+	if((status = PWParticlesRender(drawn_count, 0)) != PARTICLE_OK){
+		return status;
+	}
+	
+	//Free every particle
+	for(uint8_t i = 0; i < live_count; i++){
+		particles[i].life = 0;
+	}
+	
+	live_count = 0;
+	drawn_count = 0;
+	
+	//Return OK
+	return PARTICLE_OK;
+}
@@ -0,0 +1,98 @@
+//Host decoder for PixelWerke8 telemetry captures
+//Reads the raw UART1 stream on stdin, writes one CSV row per good record on stdout
+//Record layout is TELEMETRY_* in pixelwerke8.h
+//Build with any C99 compiler: cc -std=c99 -o telemetry_decode telemetry_decode.c
+//Capture with, for example: cat /dev/ttyUSB0 > capture.bin
+#include <stdio.h>
+#include <stdint.h>
+
+#define TELEMETRY_SYNC 0xA5
+#define TELEMETRY_BYTES 18
+
+//Function to read a LO first field
+//Takes in the record, the field's first byte and its width in bytes
+//Returns the value
+uint32_t Field(uint8_t* record, uint8_t first, uint8_t width){
+
+	uint32_t value = 0;
+
+	for(uint8_t i = width; i > 0; i--){
+		value = (value << 8) | record[first + i - 1];
+	}
+
+	return value;
+}
+
+int main(void){
+
+	uint8_t record[TELEMETRY_BYTES];
+	uint8_t fill = 0;
+	uint8_t sum = 0;
+	int c = 0;
+
+	//Records dropped for a bad checksum
+	unsigned long bad = 0;
+
+	printf("frame,phase0_us,phase1_us,phase2_us,spi_bytes,spi_sends,sprites,collisions\n");
+
+	while((c = getchar()) != EOF){
+
+		//Hunt for sync
+		if(fill == 0 && c != TELEMETRY_SYNC){
+			continue;
+		}
+
+		record[fill++] = (uint8_t) c;
+
+		if(fill < TELEMETRY_BYTES){
+			continue;
+		}
+
+		//Check sum of [16..1]
+		sum = 0;
+
+		for(uint8_t i = 1; i < TELEMETRY_BYTES - 1; i++){
+			sum += record[i];
+		}
+
+		if(sum != record[TELEMETRY_BYTES - 1]){
+
+			//Resync from the byte after this sync
+			bad++;
+
+			for(uint8_t i = 1; i < TELEMETRY_BYTES; i++){
+				if(record[i] == TELEMETRY_SYNC){
+					fill = TELEMETRY_BYTES - i;
+
+					for(uint8_t j = 0; j < fill; j++){
+						record[j] = record[i + j];
+					}
+
+					break;
+				}
+
+				fill = 0;
+			}
+
+			continue;
+		}
+
+		printf("%lu,%lu,%lu,%lu,%lu,%lu,%u,%u\n",
+			(unsigned long) Field(record, 1, 2),
+			(unsigned long) Field(record, 3, 2),
+			(unsigned long) Field(record, 5, 2),
+			(unsigned long) Field(record, 7, 2),
+			(unsigned long) Field(record, 9, 4),
+			(unsigned long) Field(record, 13, 2),
+			record[15],
+			record[16]);
+
+		fill = 0;
+	}
+
+	if(bad){
+		fprintf(stderr, "%lu bad records skipped\n", bad);
+	}
+
+	return 0;
+}